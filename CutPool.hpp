@@ -0,0 +1,137 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include "Fraqtion.hpp"
+
+// отсечение a·x <= b в пространстве основных переменных
+struct Cut {
+    std::vector<Fraqtion> a;
+    Fraqtion b;
+    int age = 0; // сколько раундов подряд отсечение не было активным
+};
+
+// глобальный пул отсечений с удалением дубликатов по хешу
+class CutPool {
+    std::vector<Cut> cuts; // отсечения пула
+    std::unordered_multimap<size_t, int> index; // хеш канонической формы -> номер отсечения
+
+    void Canonicalize(Cut &cut) const; // приведение к канонической форме
+    size_t Hash(const Cut &cut) const; // хеш канонической формы
+    bool IsSafe(const Cut &cut) const; // не приведёт ли отсечение к переполнению дробей
+    void RebuildIndex(); // перестроение индекса после удаления
+public:
+    bool Add(Cut cut); // добавление отсечения (false, если дубликат или небезопасное)
+    void Age(const std::vector<Fraqtion> &x, int maxAge); // старение неактивных отсечений и удаление старых
+    void Restore(const std::vector<Cut> &cuts); // восстановление пула из снимка (отсечения с возрастом, без проверок Add)
+
+    const std::vector<Cut>& GetCuts() const; // отсечения пула
+    int Size() const; // количество отсечений
+};
+
+// приведение к канонической форме: делим на модуль первого ненулевого коэффициента
+void CutPool::Canonicalize(Cut &cut) const {
+    for (int j = 0; j < cut.a.size(); j++) {
+        if (cut.a[j] == 0)
+            continue;
+
+        Fraqtion scale = fabs(cut.a[j]);
+
+        for (int k = 0; k < cut.a.size(); k++)
+            cut.a[k] /= scale;
+
+        cut.b /= scale;
+        return;
+    }
+}
+
+// хеш канонической формы
+size_t CutPool::Hash(const Cut &cut) const {
+    size_t hash = 0;
+    std::hash<int> hasher;
+
+    for (int j = 0; j < cut.a.size(); j++) {
+        hash = hash * 31 + hasher(cut.a[j].GetN());
+        hash = hash * 31 + hasher(cut.a[j].GetM());
+    }
+
+    hash = hash * 31 + hasher(cut.b.GetN());
+    return hash * 31 + hasher(cut.b.GetM());
+}
+
+// не приведёт ли отсечение к переполнению дробей в таблице
+bool CutPool::IsSafe(const Cut &cut) const {
+    for (int j = 0; j < cut.a.size(); j++)
+        if (cut.a[j].GetM() > 1000 || abs(cut.a[j].GetN()) > 1000000)
+            return false;
+
+    return cut.b.GetM() <= 1000 && abs(cut.b.GetN()) <= 1000000;
+}
+
+// перестроение индекса после удаления
+void CutPool::RebuildIndex() {
+    index.clear();
+
+    for (int i = 0; i < cuts.size(); i++)
+        index.insert({ Hash(cuts[i]), i });
+}
+
+// добавление отсечения (false, если дубликат или небезопасное)
+bool CutPool::Add(Cut cut) {
+    Canonicalize(cut);
+
+    if (!IsSafe(cut))
+        return false;
+
+    size_t hash = Hash(cut);
+    auto range = index.equal_range(hash);
+
+    for (auto it = range.first; it != range.second; it++)
+        if (cuts[it->second].a == cut.a && cuts[it->second].b == cut.b)
+            return false;
+
+    cut.age = 0;
+    index.insert({ hash, (int) cuts.size() });
+    cuts.push_back(cut);
+
+    return true;
+}
+
+// старение: неактивное в точке x отсечение стареет, активное молодеет, старые удаляются
+void CutPool::Age(const std::vector<Fraqtion> &x, int maxAge) {
+    std::vector<Cut> alive;
+
+    for (int i = 0; i < cuts.size(); i++) {
+        Fraqtion sum = 0;
+
+        for (int j = 0; j < cuts[i].a.size(); j++)
+            sum += cuts[i].a[j] * x[j];
+
+        cuts[i].age = sum < cuts[i].b ? cuts[i].age + 1 : 0;
+
+        if (cuts[i].age <= maxAge)
+            alive.push_back(cuts[i]);
+    }
+
+    if (alive.size() != cuts.size()) {
+        cuts = alive;
+        RebuildIndex();
+    }
+}
+
+// восстановление пула из снимка: отсечения уже канонические, возраст сохраняется
+void CutPool::Restore(const std::vector<Cut> &cuts) {
+    this->cuts = cuts;
+    RebuildIndex();
+}
+
+// отсечения пула
+const std::vector<Cut>& CutPool::GetCuts() const {
+    return cuts;
+}
+
+// количество отсечений
+int CutPool::Size() const {
+    return cuts.size();
+}
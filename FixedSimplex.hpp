@@ -0,0 +1,200 @@
+#pragma once
+
+#include <array>
+#include "Fraqtion.hpp"
+#include "SimplexMode.hpp"
+
+// симплекс-метод для задач фиксированного размера N x M с ограничениями a·x <= b, b >= 0:
+// таблица хранится в std::array, циклы имеют границы времени компиляции, а все методы
+// constexpr, поэтому постоянная задача решается на этапе компиляции, а при решении во время
+// работы не выделяется память. Правила выбора столбца и строки те же, что в Simplex::Optimize,
+// поэтому последовательность базисов совпадает с обычной таблицей
+template <int N, int M>
+class FixedSimplex {
+    static constexpr int W = N + M + 1; // ширина таблицы: основные, балансовые и свободный член
+
+    std::array<std::array<Fraqtion, W>, M> table; // симплекс таблица
+    std::array<Fraqtion, W> c; // значения целевой функции
+    std::array<Fraqtion, W> deltas; // дельты
+    std::array<int, M> basis; // базисные переменные
+    SimplexMode mode; // режим решения
+    int iterations; // количество выполненных итераций
+
+    constexpr void CalculateDeltas(); // расчёт дельт
+    constexpr bool IsOptimal() const; // проверка плана на оптимальность
+    constexpr int GetSolveColumn() const; // получение разрешающего столбца
+    constexpr int GetSolveRow(int column) const; // получение разрешающей строки
+    constexpr void Gauss(int row, int column); // исключение гаусса
+public:
+    constexpr FixedSimplex(const std::array<std::array<Fraqtion, N>, M> &a, const std::array<Fraqtion, M> &b, const std::array<Fraqtion, N> &c, SimplexMode mode);
+
+    constexpr bool Solve(); // решение задачи (false, если b < 0, функция не ограничена или дроби переполнились)
+
+    constexpr std::array<Fraqtion, N> GetX() const; // значения основных переменных
+    constexpr Fraqtion GetF() const; // значение функции
+    constexpr int GetIterations() const; // количество выполненных итераций
+};
+
+template <int N, int M>
+constexpr FixedSimplex<N, M>::FixedSimplex(const std::array<std::array<Fraqtion, N>, M> &a, const std::array<Fraqtion, M> &b, const std::array<Fraqtion, N> &c, SimplexMode mode) : table(), c(), deltas(), basis(), mode(mode), iterations(0) {
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < W; j++)
+            table[i][j] = j < N ? a[i][j] : 0;
+
+        table[i][N + i] = 1; // балансовая переменная
+        table[i][N + M] = b[i]; // свободный член
+        basis[i] = N + i;
+    }
+
+    for (int j = 0; j < W; j++) {
+        this->c[j] = j < N ? c[j] : 0;
+        deltas[j] = 0;
+    }
+}
+
+// расчёт дельт
+template <int N, int M>
+constexpr void FixedSimplex<N, M>::CalculateDeltas() {
+    for (int j = 0; j < W; j++) {
+        deltas[j] = -c[j];
+
+        for (int i = 0; i < M; i++)
+            if (c[basis[i]] != 0 && table[i][j] != 0) // нули не тратят сокращений дробей
+                deltas[j] += c[basis[i]] * table[i][j];
+    }
+}
+
+// проверка плана на оптимальность
+template <int N, int M>
+constexpr bool FixedSimplex<N, M>::IsOptimal() const {
+    for (int j = 0; j < N + M; j++) {
+        if (mode == SimplexMode::Max && deltas[j] < 0)
+            return false;
+
+        if (mode == SimplexMode::Min && deltas[j] > 0)
+            return false;
+    }
+
+    return true;
+}
+
+// получение разрешающего столбца
+template <int N, int M>
+constexpr int FixedSimplex<N, M>::GetSolveColumn() const {
+    int column = 0;
+
+    for (int j = 0; j < N + M; j++) {
+        if (mode == SimplexMode::Max && deltas[j] < deltas[column])
+            column = j;
+        else if (mode == SimplexMode::Min && deltas[j] > deltas[column])
+            column = j;
+    }
+
+    return column;
+}
+
+// получение разрешающей строки по симплекс-отношениям
+template <int N, int M>
+constexpr int FixedSimplex<N, M>::GetSolveRow(int column) const {
+    int row = -1;
+    Fraqtion best = 0;
+
+    for (int i = 0; i < M; i++) {
+        if (table[i][column] == 0 || (table[i][N + M] >= 0 && table[i][column] < 0))
+            continue;
+
+        Fraqtion q = table[i][N + M] / table[i][column];
+
+        if (row == -1 || q < best) {
+            row = i;
+            best = q;
+        }
+    }
+
+    return row;
+}
+
+// исключение гаусса
+template <int N, int M>
+constexpr void FixedSimplex<N, M>::Gauss(int row, int column) {
+    Fraqtion pivot = table[row][column];
+
+    for (int j = 0; j < W; j++)
+        table[row][j] /= pivot;
+
+    for (int i = 0; i < M; i++) {
+        if (i == row || table[i][column] == 0)
+            continue;
+
+        Fraqtion value = table[i][column];
+
+        for (int j = 0; j < W; j++)
+            if (table[row][j] != 0)
+                table[i][j] -= table[row][j] * value;
+    }
+
+    basis[row] = column;
+    iterations++;
+}
+
+// решение задачи
+template <int N, int M>
+constexpr bool FixedSimplex<N, M>::Solve() {
+    // без первой фазы начальный базис из балансовых переменных должен быть допустимым
+    for (int i = 0; i < M; i++)
+        if (table[i][N + M] < 0)
+            return false;
+
+    // на этапе компиляции переполнение дроби - ошибка компиляции, флаг нужен только во время работы
+    bool runtime = !__builtin_is_constant_evaluated();
+
+    if (runtime)
+        Fraqtion::overflow = false;
+
+    while (true) {
+        CalculateDeltas();
+
+        // переполненная дробь заменена нулём - ни оптимальность, ни план не достоверны
+        if (runtime && Fraqtion::overflow)
+            return false;
+
+        if (IsOptimal())
+            return true;
+
+        int column = GetSolveColumn();
+        int row = GetSolveRow(column);
+
+        // если нет разрешающей строки, то функция не ограничена
+        if (row == -1)
+            return false;
+
+        Gauss(row, column);
+    }
+}
+
+// значения основных переменных
+template <int N, int M>
+constexpr std::array<Fraqtion, N> FixedSimplex<N, M>::GetX() const {
+    std::array<Fraqtion, N> x{};
+
+    for (int j = 0; j < N; j++)
+        x[j] = 0;
+
+    for (int i = 0; i < M; i++)
+        if (basis[i] < N)
+            x[basis[i]] = table[i][N + M];
+
+    return x;
+}
+
+// значение функции
+template <int N, int M>
+constexpr Fraqtion FixedSimplex<N, M>::GetF() const {
+    return deltas[N + M];
+}
+
+// количество выполненных итераций
+template <int N, int M>
+constexpr int FixedSimplex<N, M>::GetIterations() const {
+    return iterations;
+}
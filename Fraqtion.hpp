@@ -2,54 +2,61 @@
 
 #include <iostream>
 #include <string>
+#include <climits>
 
 class Fraqtion {
     int n; // числитель
     int m; // знаменатель
 
-    int GCD(int a, int b) const; // получение НОД двух чисел
-    void Reduce(); // сокращение дроби
+    constexpr long long GCD(long long a, long long b) const; // получение НОД двух чисел
+    constexpr void Reduce(); // сокращение дроби
+    constexpr void Assign(long long n, long long m); // сокращение 64-битной дроби и запись в числитель и знаменатель
 public:
-    Fraqtion(int n = 1, int m = 1); // конструктор из отношения двух чисел
-    Fraqtion(const Fraqtion& fraqtion); // конструктор копирования
+    static thread_local bool overflow; // было ли переполнение int после сокращения в этом потоке (значение при этом заменяется нулём)
 
-    Fraqtion& operator=(const Fraqtion& fraqtion); // оператор присваивания
+    constexpr Fraqtion(int n = 1, int m = 1); // конструктор из отношения двух чисел
+    constexpr Fraqtion(const Fraqtion& fraqtion); // конструктор копирования
 
-    int GetN() const; // получение числителя
-    int GetM() const; // получение знаменателя
+    constexpr Fraqtion& operator=(const Fraqtion& fraqtion); // оператор присваивания
 
-    Fraqtion GetRealPart() const;
-    Fraqtion GetIntPart() const;
+    constexpr int GetN() const; // получение числителя
+    constexpr int GetM() const; // получение знаменателя
 
-    void SetN(int n); // изменение числителя
-    void SetM(int m); // изменение знаменателя
+    constexpr Fraqtion GetRealPart() const;
+    constexpr Fraqtion GetIntPart() const;
 
-    bool IsInteger() const; // проверка на целое число
+    constexpr void SetN(int n); // изменение числителя
+    constexpr void SetM(int m); // изменение знаменателя
 
-    Fraqtion operator+(const Fraqtion& fraqtion) const; // оператор сложения
-    Fraqtion operator-(const Fraqtion& fraqtion) const; // оператор вычитания
-    Fraqtion operator*(const Fraqtion& fraqtion) const; // оператор умножения
-    Fraqtion operator/(const Fraqtion& fraqtion) const; // оператор деления
-    Fraqtion operator-() const; // унарный минус
+    constexpr bool IsInteger() const; // проверка на целое число
+    constexpr double ToDouble() const; // перевод в вещественное число
 
-    Fraqtion& operator+=(const Fraqtion& fraqtion); // оператор сложения с присваиванием
-    Fraqtion& operator-=(const Fraqtion& fraqtion); // оператор вычитания с присваиванием
-    Fraqtion& operator*=(const Fraqtion& fraqtion); // оператор умножения с присваиванием
-    Fraqtion& operator/=(const Fraqtion& fraqtion); // оператор деления с присваиванием
+    constexpr Fraqtion operator+(const Fraqtion& fraqtion) const; // оператор сложения
+    constexpr Fraqtion operator-(const Fraqtion& fraqtion) const; // оператор вычитания
+    constexpr Fraqtion operator*(const Fraqtion& fraqtion) const; // оператор умножения
+    constexpr Fraqtion operator/(const Fraqtion& fraqtion) const; // оператор деления
+    constexpr Fraqtion operator-() const; // унарный минус
 
-    bool operator==(const Fraqtion& fraqtion) const; // проверка на равенство
-    bool operator!=(const Fraqtion& fraqtion) const; // проверка на неравенство
+    constexpr Fraqtion& operator+=(const Fraqtion& fraqtion); // оператор сложения с присваиванием
+    constexpr Fraqtion& operator-=(const Fraqtion& fraqtion); // оператор вычитания с присваиванием
+    constexpr Fraqtion& operator*=(const Fraqtion& fraqtion); // оператор умножения с присваиванием
+    constexpr Fraqtion& operator/=(const Fraqtion& fraqtion); // оператор деления с присваиванием
 
-    bool operator<(const Fraqtion& fraqtion) const; // проверка на меньше
-    bool operator>(const Fraqtion& fraqtion) const; // проверка на больше
-    bool operator<=(const Fraqtion& fraqtion) const; // проверка на меньше или равно
-    bool operator>=(const Fraqtion& fraqtion) const; // проверка на больше или равно
+    constexpr bool operator==(const Fraqtion& fraqtion) const; // проверка на равенство
+    constexpr bool operator!=(const Fraqtion& fraqtion) const; // проверка на неравенство
+
+    constexpr bool operator<(const Fraqtion& fraqtion) const; // проверка на меньше
+    constexpr bool operator>(const Fraqtion& fraqtion) const; // проверка на больше
+    constexpr bool operator<=(const Fraqtion& fraqtion) const; // проверка на меньше или равно
+    constexpr bool operator>=(const Fraqtion& fraqtion) const; // проверка на больше или равно
 
     friend std::ostream& operator<<(std::ostream &os, const Fraqtion& fraqtion); // оператор вывода в поток
 };
 
+thread_local bool Fraqtion::overflow = false;
+
 // получение НОД двух чисел
-int Fraqtion::GCD(int a, int b) const {
+constexpr long long Fraqtion::GCD(long long a, long long b) const {
 	if (a < 0)
 		a = -a; // если первое число отрицательное, то меняем у него знак
 
@@ -60,7 +67,7 @@ int Fraqtion::GCD(int a, int b) const {
 	while (b != 0) {
 		a %= b;
 
-		int tmp = a;
+		long long tmp = a;
 		a = b;
 		b = tmp;
 	}
@@ -69,7 +76,7 @@ int Fraqtion::GCD(int a, int b) const {
 }
 
 // сокращение дроби
-void Fraqtion::Reduce() {
+constexpr void Fraqtion::Reduce() {
 	int gcd = GCD(n, m); // находим НОД числителя и знаменателя
 	
 	// делим числитель и знаменатель на их НОД
@@ -83,22 +90,45 @@ void Fraqtion::Reduce() {
 	}
 }
 
-// конструктор из отношения двух чисел
-Fraqtion::Fraqtion(int n, int m) {
-	this->n = n;
-	this->m = m;
+// сокращение 64-битной дроби и запись в числитель и знаменатель
+// (промежуточные произведения считаются в long long, чтобы не переполнять int до сокращения)
+constexpr void Fraqtion::Assign(long long n, long long m) {
+	long long gcd = GCD(n, m);
+
+	if (gcd == 0)
+		gcd = 1;
+
+	n /= gcd;
+	m /= gcd;
 
+	if (m < 0) {
+		m *= -1;
+		n *= -1;
+	}
+
+	// сокращённая дробь не помещается в int
+	if (n > INT_MAX || n < -INT_MAX || m > INT_MAX) {
+		overflow = true;
+		this->n = 0;
+		this->m = 1;
+		return;
+	}
+
+	this->n = (int) n;
+	this->m = (int) m;
+}
+
+// конструктор из отношения двух чисел
+constexpr Fraqtion::Fraqtion(int n, int m) : n(n), m(m) {
 	Reduce(); // сокращаем
 }
 
 // конструктор копирования
-Fraqtion::Fraqtion(const Fraqtion& fraqtion) {
-	n = fraqtion.n;
-	m = fraqtion.m;
+constexpr Fraqtion::Fraqtion(const Fraqtion& fraqtion) : n(fraqtion.n), m(fraqtion.m) {
 }
 
 // оператор присваивания
-Fraqtion& Fraqtion::operator=(const Fraqtion& fraqtion) {
+constexpr Fraqtion& Fraqtion::operator=(const Fraqtion& fraqtion) {
     n = fraqtion.n;
 	m = fraqtion.m;
 
@@ -106,149 +136,151 @@ Fraqtion& Fraqtion::operator=(const Fraqtion& fraqtion) {
 }
 
 // получение числителя
-int Fraqtion::GetN() const {
+constexpr int Fraqtion::GetN() const {
 	return n;
 }
 
 // получение знаменателя
-int Fraqtion::GetM() const {
+constexpr int Fraqtion::GetM() const {
 	return m;
 }
 
-// -5/3 == -1.666 -> 1 - 2/3
-Fraqtion Fraqtion::GetRealPart() const {
-    if (n > 0)
-        return Fraqtion(n % m, m);
-
-    return Fraqtion(m - ((-n) % m), m);
+// -5/3 == -1.666 -> -2 + 1/3, для целых чисел дробная часть равна 0
+constexpr Fraqtion Fraqtion::GetRealPart() const {
+    return Fraqtion((n % m + m) % m, m);
 }
 
-Fraqtion Fraqtion::GetIntPart() const {
+constexpr Fraqtion Fraqtion::GetIntPart() const {
     return Fraqtion(n / m, 1);
 }
 
 // изменение числителя
-void Fraqtion::SetN(int n) {
+constexpr void Fraqtion::SetN(int n) {
 	this->n = n;
 
 	Reduce();
 }
 
 // изменение знаменателя
-void Fraqtion::SetM(int m) {
+constexpr void Fraqtion::SetM(int m) {
 	this->m = m;
 
 	Reduce();
 }
 
 // проверка на целое число
-bool Fraqtion::IsInteger() const {
-    return m != 0 && abs(n) % m == 0;
+constexpr bool Fraqtion::IsInteger() const {
+    return m != 0 && n % m == 0;
+}
+
+// перевод в вещественное число
+constexpr double Fraqtion::ToDouble() const {
+    return (double) n / m;
 }
 
 // оператор сложения
-Fraqtion Fraqtion::operator+(const Fraqtion& fraqtion) const {
-	return Fraqtion(n * fraqtion.m + fraqtion.n * m, m * fraqtion.m); // возвращаем сумму дробей
+constexpr Fraqtion Fraqtion::operator+(const Fraqtion& fraqtion) const {
+	Fraqtion result;
+	result.Assign((long long) n * fraqtion.m + (long long) fraqtion.n * m, (long long) m * fraqtion.m);
+
+	return result; // возвращаем сумму дробей
 }
 
 // оператор вычитания
-Fraqtion Fraqtion::operator-(const Fraqtion& fraqtion) const {
-	return Fraqtion(n * fraqtion.m - fraqtion.n * m, m * fraqtion.m); // возвращаем разность дробей
+constexpr Fraqtion Fraqtion::operator-(const Fraqtion& fraqtion) const {
+	Fraqtion result;
+	result.Assign((long long) n * fraqtion.m - (long long) fraqtion.n * m, (long long) m * fraqtion.m);
+
+	return result; // возвращаем разность дробей
 }
 
 // оператор умножения
-Fraqtion Fraqtion::operator*(const Fraqtion& fraqtion) const {
-	return Fraqtion(n * fraqtion.n, m * fraqtion.m); // возвращаем произведение дробей
+constexpr Fraqtion Fraqtion::operator*(const Fraqtion& fraqtion) const {
+	Fraqtion result;
+	result.Assign((long long) n * fraqtion.n, (long long) m * fraqtion.m);
+
+	return result; // возвращаем произведение дробей
 }
 
 // оператор деления
-Fraqtion Fraqtion::operator/(const Fraqtion& fraqtion) const {
-	return Fraqtion(n * fraqtion.m, m * fraqtion.n); // возвращаем отношение дробей
+constexpr Fraqtion Fraqtion::operator/(const Fraqtion& fraqtion) const {
+	Fraqtion result;
+	result.Assign((long long) n * fraqtion.m, (long long) m * fraqtion.n);
+
+	return result; // возвращаем отношение дробей
 }
 
 // унарный минус
-Fraqtion Fraqtion::operator-() const {
+constexpr Fraqtion Fraqtion::operator-() const {
     return Fraqtion(-n, m);
 }
 
 // оператор сложения с присваиванием
-Fraqtion& Fraqtion::operator+=(const Fraqtion& fraqtion) {
-	n = n * fraqtion.m + fraqtion.n * m;
-	m = m * fraqtion.m;
-
-	Reduce();
+constexpr Fraqtion& Fraqtion::operator+=(const Fraqtion& fraqtion) {
+	Assign((long long) n * fraqtion.m + (long long) fraqtion.n * m, (long long) m * fraqtion.m);
 
 	return *this;
 }
 
 // оператор вычитания с присваиванием
-Fraqtion& Fraqtion::operator-=(const Fraqtion& fraqtion) {
-	n = n * fraqtion.m - fraqtion.n * m;
-	m = m * fraqtion.m;
-
-	Reduce();
+constexpr Fraqtion& Fraqtion::operator-=(const Fraqtion& fraqtion) {
+	Assign((long long) n * fraqtion.m - (long long) fraqtion.n * m, (long long) m * fraqtion.m);
 
 	return *this;
 }
 
 // оператор умножения с присваиванием
-Fraqtion& Fraqtion::operator*=(const Fraqtion& fraqtion) {
-	n *= fraqtion.n;
-	m *= fraqtion.m;
-
-	Reduce();
+constexpr Fraqtion& Fraqtion::operator*=(const Fraqtion& fraqtion) {
+	Assign((long long) n * fraqtion.n, (long long) m * fraqtion.m);
 
 	return *this;
 }
 
 // оператор деления с присваиванием
-Fraqtion& Fraqtion::operator/=(const Fraqtion& fraqtion) {
-	n *= fraqtion.m;
-	m *= fraqtion.n;
-
-	Reduce();
+constexpr Fraqtion& Fraqtion::operator/=(const Fraqtion& fraqtion) {
+	Assign((long long) n * fraqtion.m, (long long) m * fraqtion.n);
 
 	return *this;
 }
 
 // проверка на равентво
-bool Fraqtion::operator==(const Fraqtion& fraqtion) const {
-	return n * fraqtion.m == m * fraqtion.n;
+constexpr bool Fraqtion::operator==(const Fraqtion& fraqtion) const {
+	return (long long) n * fraqtion.m == (long long) m * fraqtion.n;
 }
 
 // проверка на не равентво
-bool Fraqtion::operator!=(const Fraqtion& fraqtion) const {
-	return n * fraqtion.m != m * fraqtion.n;
+constexpr bool Fraqtion::operator!=(const Fraqtion& fraqtion) const {
+	return (long long) n * fraqtion.m != (long long) m * fraqtion.n;
 }
 
 // проверка на меньше
-bool Fraqtion::operator<(const Fraqtion& fraqtion) const {
-	int n1 = n * fraqtion.m;
-	int n2 = fraqtion.n * m;
+constexpr bool Fraqtion::operator<(const Fraqtion& fraqtion) const {
+	long long n1 = (long long) n * fraqtion.m;
+	long long n2 = (long long) fraqtion.n * m;
 
 	return n1 < n2;
 }
 
 // проверка на больше
-bool Fraqtion::operator>(const Fraqtion& fraqtion) const {
-	int n1 = n * fraqtion.m;
-	int n2 = fraqtion.n * m;
+constexpr bool Fraqtion::operator>(const Fraqtion& fraqtion) const {
+	long long n1 = (long long) n * fraqtion.m;
+	long long n2 = (long long) fraqtion.n * m;
 
 	return n1 > n2;
 }
 
 // проверка на меньше или равно
-bool Fraqtion::operator<=(const Fraqtion& fraqtion) const {
-	int n1 = n * fraqtion.m;
-	int n2 = fraqtion.n * m;
+constexpr bool Fraqtion::operator<=(const Fraqtion& fraqtion) const {
+	long long n1 = (long long) n * fraqtion.m;
+	long long n2 = (long long) fraqtion.n * m;
 
 	return n1 <= n2;
 }
 
 // проверка на больше или равно
-bool Fraqtion::operator>=(const Fraqtion& fraqtion) const {
-	int n1 = n * fraqtion.m;
-	int n2 = fraqtion.n * m;
+constexpr bool Fraqtion::operator>=(const Fraqtion& fraqtion) const {
+	long long n1 = (long long) n * fraqtion.m;
+	long long n2 = (long long) fraqtion.n * m;
 
 	return n1 >= n2;
 }
@@ -268,6 +300,6 @@ std::ostream& operator<<(std::ostream &os, const Fraqtion& fraqtion) {
     return os << s;
 }
 
-Fraqtion fabs(const Fraqtion &f) {
+constexpr Fraqtion fabs(const Fraqtion &f) {
     return f > 0 ? f : -f;
 }
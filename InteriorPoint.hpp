@@ -0,0 +1,313 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// прямо-двойственный метод внутренней точки (предиктор-корректор Мехротры)
+// для задачи min c·x, Ax = b, x >= 0
+class InteriorPoint {
+    int m; // количество ограничений
+    int n; // количество переменных
+
+    std::vector<std::vector<double>> a; // матрица ограничений
+    std::vector<double> b; // свободные члены
+    std::vector<double> c; // коэффициенты целевой функции
+
+    std::vector<double> x; // прямые переменные
+    std::vector<double> y; // двойственные переменные
+    std::vector<double> s; // двойственные невязки
+
+    int iterations; // количество выполненных итераций
+
+    std::vector<double> MultiplyA(const std::vector<double> &v) const; // A * v
+    std::vector<double> MultiplyAT(const std::vector<double> &v) const; // A^T * v
+    std::vector<std::vector<double>> NormalMatrix(const std::vector<double> &d) const; // A * D * A^T
+    void Cholesky(std::vector<std::vector<double>> &l) const; // разложение Холецкого на месте
+    std::vector<double> CholeskySolve(const std::vector<std::vector<double>> &l, const std::vector<double> &r) const; // решение L L^T v = r
+
+    // направление Ньютона при заданной правой части условия дополняющей нежёсткости
+    void Direction(const std::vector<std::vector<double>> &l, const std::vector<double> &rp, const std::vector<double> &rd, const std::vector<double> &rc, std::vector<double> &dx, std::vector<double> &dy, std::vector<double> &ds) const;
+    double StepLength(const std::vector<double> &v, const std::vector<double> &dv) const; // максимальный шаг до границы
+    void InitialPoint(); // начальная точка по эвристике Мехротры
+public:
+    InteriorPoint(const std::vector<std::vector<double>> &a, const std::vector<double> &b, const std::vector<double> &c);
+
+    bool Solve(int maxIterations = 100, double eps = 1e-9, bool debug = false); // решение задачи
+
+    const std::vector<double>& GetX() const; // прямое решение
+    const std::vector<double>& GetS() const; // двойственные невязки
+    int GetIterations() const; // количество итераций
+};
+
+InteriorPoint::InteriorPoint(const std::vector<std::vector<double>> &a, const std::vector<double> &b, const std::vector<double> &c) {
+    this->a = a;
+    this->b = b;
+    this->c = c;
+
+    this->m = b.size();
+    this->n = c.size();
+    this->iterations = 0;
+}
+
+// A * v
+std::vector<double> InteriorPoint::MultiplyA(const std::vector<double> &v) const {
+    std::vector<double> result(m, 0);
+
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < n; j++)
+            result[i] += a[i][j] * v[j];
+
+    return result;
+}
+
+// A^T * v
+std::vector<double> InteriorPoint::MultiplyAT(const std::vector<double> &v) const {
+    std::vector<double> result(n, 0);
+
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < n; j++)
+            result[j] += a[i][j] * v[i];
+
+    return result;
+}
+
+// A * D * A^T
+std::vector<std::vector<double>> InteriorPoint::NormalMatrix(const std::vector<double> &d) const {
+    std::vector<std::vector<double>> result(m, std::vector<double>(m, 0));
+
+    for (int i = 0; i < m; i++) {
+        for (int k = 0; k <= i; k++) {
+            double sum = 0;
+
+            for (int j = 0; j < n; j++)
+                sum += a[i][j] * d[j] * a[k][j];
+
+            result[i][k] = sum;
+            result[k][i] = sum;
+        }
+    }
+
+    return result;
+}
+
+// разложение Холецкого на месте (нижний треугольник)
+void InteriorPoint::Cholesky(std::vector<std::vector<double>> &l) const {
+    for (int j = 0; j < m; j++) {
+        double diagonal = l[j][j];
+
+        for (int k = 0; k < j; k++)
+            diagonal -= l[j][k] * l[j][k];
+
+        // вырожденные строки (линейно зависимые ограничения) регуляризуем
+        if (diagonal <= 1e-14)
+            diagonal = 1e-14;
+
+        l[j][j] = sqrt(diagonal);
+
+        for (int i = j + 1; i < m; i++) {
+            double sum = l[i][j];
+
+            for (int k = 0; k < j; k++)
+                sum -= l[i][k] * l[j][k];
+
+            l[i][j] = sum / l[j][j];
+        }
+    }
+}
+
+// решение L L^T v = r прямой и обратной подстановкой
+std::vector<double> InteriorPoint::CholeskySolve(const std::vector<std::vector<double>> &l, const std::vector<double> &r) const {
+    std::vector<double> v(r);
+
+    for (int i = 0; i < m; i++) {
+        for (int k = 0; k < i; k++)
+            v[i] -= l[i][k] * v[k];
+
+        v[i] /= l[i][i];
+    }
+
+    for (int i = m - 1; i >= 0; i--) {
+        for (int k = i + 1; k < m; k++)
+            v[i] -= l[k][i] * v[k];
+
+        v[i] /= l[i][i];
+    }
+
+    return v;
+}
+
+// направление Ньютона: A dx = rp, A^T dy + ds = rd, S dx + X ds = rc
+void InteriorPoint::Direction(const std::vector<std::vector<double>> &l, const std::vector<double> &rp, const std::vector<double> &rd, const std::vector<double> &rc, std::vector<double> &dx, std::vector<double> &dy, std::vector<double> &ds) const {
+    std::vector<double> t(n);
+
+    for (int j = 0; j < n; j++)
+        t[j] = rc[j] / s[j] - x[j] / s[j] * rd[j];
+
+    std::vector<double> r = MultiplyA(t);
+
+    for (int i = 0; i < m; i++)
+        r[i] = rp[i] - r[i];
+
+    dy = CholeskySolve(l, r);
+
+    std::vector<double> aty = MultiplyAT(dy);
+    ds = std::vector<double>(n);
+    dx = std::vector<double>(n);
+
+    for (int j = 0; j < n; j++) {
+        ds[j] = rd[j] - aty[j];
+        dx[j] = (rc[j] - x[j] * ds[j]) / s[j];
+    }
+}
+
+// максимальный шаг, при котором v + alpha * dv остаётся неотрицательным
+double InteriorPoint::StepLength(const std::vector<double> &v, const std::vector<double> &dv) const {
+    double alpha = 1;
+
+    for (int j = 0; j < n; j++)
+        if (dv[j] < 0)
+            alpha = std::min(alpha, -v[j] / dv[j]);
+
+    return alpha;
+}
+
+// начальная точка по эвристике Мехротры
+void InteriorPoint::InitialPoint() {
+    std::vector<std::vector<double>> l = NormalMatrix(std::vector<double>(n, 1));
+    Cholesky(l);
+
+    x = MultiplyAT(CholeskySolve(l, b)); // решение минимальной нормы для Ax = b
+    y = CholeskySolve(l, MultiplyA(c));
+    s = MultiplyAT(y);
+
+    for (int j = 0; j < n; j++)
+        s[j] = c[j] - s[j];
+
+    double dx = 0, ds = 0;
+
+    for (int j = 0; j < n; j++) {
+        dx = std::max(dx, -1.5 * x[j]);
+        ds = std::max(ds, -1.5 * s[j]);
+    }
+
+    double xs = 0, sumX = 0, sumS = 0;
+
+    for (int j = 0; j < n; j++) {
+        xs += (x[j] + dx) * (s[j] + ds);
+        sumX += x[j] + dx;
+        sumS += s[j] + ds;
+    }
+
+    for (int j = 0; j < n; j++) {
+        x[j] += dx + 0.5 * xs / std::max(sumS, 1e-12);
+        s[j] += ds + 0.5 * xs / std::max(sumX, 1e-12);
+
+        // защита от нулевой точки для вырожденных данных
+        x[j] = std::max(x[j], 1e-4);
+        s[j] = std::max(s[j], 1e-4);
+    }
+}
+
+// решение задачи
+bool InteriorPoint::Solve(int maxIterations, double eps, bool debug) {
+    InitialPoint();
+
+    double normB = 0, normC = 0;
+
+    for (int i = 0; i < m; i++)
+        normB = std::max(normB, fabs(b[i]));
+
+    for (int j = 0; j < n; j++)
+        normC = std::max(normC, fabs(c[j]));
+
+    for (iterations = 0; iterations < maxIterations; iterations++) {
+        // невязки прямой и двойственной задачи
+        std::vector<double> rp = MultiplyA(x);
+        std::vector<double> rd = MultiplyAT(y);
+        double errorP = 0, errorD = 0, mu = 0;
+
+        for (int i = 0; i < m; i++) {
+            rp[i] = b[i] - rp[i];
+            errorP = std::max(errorP, fabs(rp[i]));
+        }
+
+        for (int j = 0; j < n; j++) {
+            rd[j] = c[j] - rd[j] - s[j];
+            errorD = std::max(errorD, fabs(rd[j]));
+            mu += x[j] * s[j];
+        }
+
+        mu /= n;
+
+        if (debug)
+            std::cout << "IPM iteration " << iterations << ": mu = " << mu << ", primal = " << errorP << ", dual = " << errorD << std::endl;
+
+        if (errorP <= eps * (1 + normB) && errorD <= eps * (1 + normC) && mu <= eps)
+            return true;
+
+        std::vector<double> d(n);
+
+        for (int j = 0; j < n; j++)
+            d[j] = x[j] / s[j];
+
+        std::vector<std::vector<double>> l = NormalMatrix(d);
+        Cholesky(l);
+
+        // предиктор: аффинное направление
+        std::vector<double> rc(n), dxa, dya, dsa;
+
+        for (int j = 0; j < n; j++)
+            rc[j] = -x[j] * s[j];
+
+        Direction(l, rp, rd, rc, dxa, dya, dsa);
+
+        double alphaP = StepLength(x, dxa);
+        double alphaD = StepLength(s, dsa);
+        double muAffine = 0;
+
+        for (int j = 0; j < n; j++)
+            muAffine += (x[j] + alphaP * dxa[j]) * (s[j] + alphaD * dsa[j]);
+
+        muAffine /= n;
+
+        double sigma = pow(muAffine / mu, 3); // параметр центрирования
+
+        // корректор с центрированием
+        std::vector<double> dx, dy, ds;
+
+        for (int j = 0; j < n; j++)
+            rc[j] = sigma * mu - x[j] * s[j] - dxa[j] * dsa[j];
+
+        Direction(l, rp, rd, rc, dx, dy, ds);
+
+        alphaP = std::min(1.0, 0.99 * StepLength(x, dx));
+        alphaD = std::min(1.0, 0.99 * StepLength(s, ds));
+
+        for (int j = 0; j < n; j++) {
+            x[j] += alphaP * dx[j];
+            s[j] += alphaD * ds[j];
+        }
+
+        for (int i = 0; i < m; i++)
+            y[i] += alphaD * dy[i];
+    }
+
+    return false; // не сошлось за отведённое число итераций
+}
+
+// прямое решение
+const std::vector<double>& InteriorPoint::GetX() const {
+    return x;
+}
+
+// двойственные невязки
+const std::vector<double>& InteriorPoint::GetS() const {
+    return s;
+}
+
+// количество итераций
+int InteriorPoint::GetIterations() const {
+    return iterations;
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <vector>
+#include <list>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <unordered_map>
+#include <cstdio>
+#include "Fraqtion.hpp"
+
+const char LP_CACHE_MAGIC[4] = { 'L', 'P', 'C', 'H' }; // сигнатура файла кэша
+const int32_t LP_CACHE_VERSION = 2; // версия формата кэша
+const int32_t LP_CACHE_ENTRY_LIMIT = 1000000; // наибольшее число записей в файле кэша
+const long long LP_CACHE_WORD_LIMIT = 10000000; // наибольшее число int32 во всех записях файла кэша
+
+// закэшированный результат LP-релаксации
+struct LpCacheEntry {
+    std::vector<int32_t> problem; // каноническая запись задачи: n, число строк, режим (0 - max, 1 - min), c, затем строки: тип, b, a (дробь - пара int32)
+    bool feasible = false; // есть ли у задачи решение
+    Fraqtion f; // оптимальное значение функции
+    std::vector<int> basis; // оптимальный базис: j < n - основная переменная, n + p - балансовая строки p в канонической нумерации
+};
+
+// кэш результатов LP-релаксаций с адресацией по содержимому: запись ищется по хешу канонической записи задачи,
+// а попаданием считается только полное совпадение записи; давно не использованные записи вытесняются
+class LpCache {
+    typedef std::list<std::pair<uint64_t, LpCacheEntry>> EntryList;
+
+    int capacity; // наибольшее число записей
+    EntryList entries; // записи от недавно использованных к давним
+    std::unordered_map<uint64_t, EntryList::iterator> index; // ключ -> запись
+    int hits; // число попаданий
+    int misses; // число промахов
+
+    void WriteInt(std::ostream &os, int32_t value) const; // запись целого числа в файл
+    bool ReadInt(std::istream &is, int32_t &value) const; // чтение целого числа из файла
+    bool ReadEntry(std::istream &is, long long &words, LpCacheEntry &entry) const; // чтение и проверка записи из файла
+    EntryList::iterator Find(const std::vector<int32_t> &problem); // запись той же задачи (end, если её нет)
+public:
+    LpCache(int capacity = 1024);
+
+    static uint64_t Key(const std::vector<int32_t> &problem); // хеш FNV-1a канонической записи задачи
+
+    bool Get(const std::vector<int32_t> &problem, LpCacheEntry &entry); // поиск записи (найденная становится самой недавней)
+    bool Peek(const std::vector<int32_t> &problem, LpCacheEntry &entry); // поиск записи без учёта в статистике и порядке вытеснения
+    void Put(const LpCacheEntry &entry); // добавление записи с вытеснением самой давней (запись с тем же хешем заменяется)
+
+    bool Save(const std::string &path) const; // сохранение кэша в файл
+    bool Load(const std::string &path); // загрузка кэша из файла
+
+    int Size() const; // количество записей
+    int GetHits() const; // число попаданий
+    int GetMisses() const; // число промахов
+};
+
+LpCache::LpCache(int capacity) {
+    this->capacity = capacity;
+    this->hits = 0;
+    this->misses = 0;
+}
+
+// запись целого числа в файл
+void LpCache::WriteInt(std::ostream &os, int32_t value) const {
+    os.write((const char *) &value, sizeof(value));
+}
+
+// чтение целого числа из файла
+bool LpCache::ReadInt(std::istream &is, int32_t &value) const {
+    return (bool) is.read((char *) &value, sizeof(value));
+}
+
+// хеш FNV-1a канонической записи задачи
+uint64_t LpCache::Key(const std::vector<int32_t> &problem) {
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (int i = 0; i < problem.size(); i++) {
+        hash ^= (uint32_t) problem[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// запись той же задачи: совпадения хеша мало, сравнивается вся запись
+LpCache::EntryList::iterator LpCache::Find(const std::vector<int32_t> &problem) {
+    auto it = index.find(Key(problem));
+
+    if (it == index.end() || it->second->second.problem != problem)
+        return entries.end();
+
+    return it->second;
+}
+
+// поиск записи (найденная становится самой недавней)
+bool LpCache::Get(const std::vector<int32_t> &problem, LpCacheEntry &entry) {
+    auto it = Find(problem);
+
+    if (it == entries.end()) {
+        misses++;
+        return false;
+    }
+
+    entries.splice(entries.begin(), entries, it);
+    entry = it->second;
+    hits++;
+
+    return true;
+}
+
+// поиск записи без учёта в статистике и порядке вытеснения
+bool LpCache::Peek(const std::vector<int32_t> &problem, LpCacheEntry &entry) {
+    auto it = Find(problem);
+
+    if (it == entries.end())
+        return false;
+
+    entry = it->second;
+    return true;
+}
+
+// добавление записи с вытеснением самой давней (запись с тем же хешем заменяется)
+void LpCache::Put(const LpCacheEntry &entry) {
+    uint64_t key = Key(entry.problem);
+    auto it = index.find(key);
+
+    if (it != index.end()) {
+        it->second->second = entry;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+
+    entries.push_front({ key, entry });
+    index[key] = entries.begin();
+
+    if (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+// сохранение кэша в файл
+// формат: сигнатура, версия, число записей, затем записи от давних к недавним: размер и слова
+// канонической записи задачи, допустимость, числитель и знаменатель функции, размер базиса и базис;
+// кэш пишется во временный файл и переименовывается, так что прежний файл не портится при сбое
+bool LpCache::Save(const std::string &path) const {
+    std::string temporary = path + ".tmp";
+    std::ofstream fout(temporary, std::ios::binary);
+
+    if (!fout)
+        return false;
+
+    fout.write(LP_CACHE_MAGIC, 4);
+    WriteInt(fout, LP_CACHE_VERSION);
+    WriteInt(fout, entries.size());
+
+    for (auto it = entries.rbegin(); it != entries.rend(); it++) {
+        WriteInt(fout, it->second.problem.size());
+
+        for (int i = 0; i < it->second.problem.size(); i++)
+            WriteInt(fout, it->second.problem[i]);
+
+        WriteInt(fout, it->second.feasible);
+        WriteInt(fout, it->second.f.GetN());
+        WriteInt(fout, it->second.f.GetM());
+        WriteInt(fout, it->second.basis.size());
+
+        for (int i = 0; i < it->second.basis.size(); i++)
+            WriteInt(fout, it->second.basis[i]);
+    }
+
+    fout.close();
+
+    if (!fout || std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// чтение и проверка записи: каждый размер ограничен до выделения памяти (words - оставшийся запас слов),
+// запись задачи должна быть согласована с n и числом строк, базис - по одному номеру < n + строк на строку
+bool LpCache::ReadEntry(std::istream &is, long long &words, LpCacheEntry &entry) const {
+    int32_t size, feasible, fn, fm, basisSize;
+
+    if (!ReadInt(is, size) || size < 3 || size > words)
+        return false;
+
+    entry.problem.resize(size);
+    words -= size;
+
+    for (int i = 0; i < size; i++)
+        if (!ReadInt(is, entry.problem[i]))
+            return false;
+
+    long long n = entry.problem[0], rows = entry.problem[1];
+
+    if (n <= 0 || rows < 0 || n > size || rows > size || (entry.problem[2] != 0 && entry.problem[2] != 1) || 3 + 2 * n + rows * (3 + 2 * n) != size)
+        return false;
+
+    // знаменатели c, b и a положительны
+    for (int i = 0; i < n; i++)
+        if (entry.problem[3 + 2 * i + 1] <= 0)
+            return false;
+
+    for (long long i = 0; i < rows; i++) {
+        long long start = 3 + 2 * n + i * (3 + 2 * n);
+
+        if (entry.problem[start] < 0 || entry.problem[start] > 2)
+            return false;
+
+        for (long long j = 0; j <= n; j++)
+            if (entry.problem[start + 2 + 2 * j] <= 0)
+                return false;
+    }
+
+    if (!ReadInt(is, feasible) || (feasible != 0 && feasible != 1) || !ReadInt(is, fn) || !ReadInt(is, fm) || fm <= 0)
+        return false;
+
+    if (!ReadInt(is, basisSize) || basisSize != (feasible ? rows : 0))
+        return false;
+
+    entry.feasible = feasible;
+    entry.f = Fraqtion(fn, fm);
+    entry.basis.resize(basisSize);
+
+    for (int i = 0; i < basisSize; i++)
+        if (!ReadInt(is, entry.basis[i]) || entry.basis[i] < 0 || entry.basis[i] >= n + rows)
+            return false;
+
+    return true;
+}
+
+// загрузка кэша из файла (записи добавляются к имеющимся, порядок использования сохраняется);
+// испорченный или обрезанный файл не загружается и кэш не меняет
+bool LpCache::Load(const std::string &path) {
+    std::ifstream fin(path, std::ios::binary);
+    char magic[4];
+    int32_t version, count;
+
+    if (!fin || !fin.read(magic, 4) || !std::equal(magic, magic + 4, LP_CACHE_MAGIC))
+        return false;
+
+    if (!ReadInt(fin, version) || version != LP_CACHE_VERSION || !ReadInt(fin, count) || count < 0 || count > LP_CACHE_ENTRY_LIMIT)
+        return false;
+
+    std::vector<LpCacheEntry> loaded;
+    long long words = LP_CACHE_WORD_LIMIT;
+
+    for (int t = 0; t < count; t++) {
+        LpCacheEntry entry;
+
+        if (!ReadEntry(fin, words, entry))
+            return false;
+
+        loaded.push_back(entry);
+    }
+
+    if (fin.peek() != EOF)
+        return false;
+
+    for (int t = 0; t < loaded.size(); t++)
+        Put(loaded[t]);
+
+    return true;
+}
+
+// количество записей
+int LpCache::Size() const {
+    return entries.size();
+}
+
+// число попаданий
+int LpCache::GetHits() const {
+    return hits;
+}
+
+// число промахов
+int LpCache::GetMisses() const {
+    return misses;
+}
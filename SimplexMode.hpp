@@ -0,0 +1,7 @@
+#pragma once
+
+// тип симплекс решения (общий для Simplex и FixedSimplex)
+enum class SimplexMode {
+    Max,
+    Min
+};
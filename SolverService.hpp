@@ -0,0 +1,510 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <set>
+#include <memory>
+#include "simplex.hpp"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// ответ ушедшему клиенту не должен завершать службу сигналом SIGPIPE; где флага нет (macOS),
+// сокету клиента задаётся SO_NOSIGPIPE
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+const int SERVICE_SIZE_LIMIT = 10000; // наибольшие n и m задачи, принятой через сокет
+const long long SERVICE_CELL_LIMIT = 1000000; // наибольшее число клеток симплекс-таблицы m * (n + m + 1) такой задачи
+
+// команды протокола службы: каждое сообщение - последовательность int32,
+// дробь передаётся парой числитель/знаменатель
+enum class ServiceCommand {
+    Submit = 1, // постановка задачи в очередь, ответ - номер задачи
+    Wait = 2, // ожидание результата задачи
+    Cancel = 3, // отмена задачи
+    Shutdown = 4 // остановка службы
+};
+
+// задача службы
+struct ServiceJob {
+    int id = 0; // номер задачи
+    int family = -1; // семейство моделей для тёплого старта (-1 - без тёплого старта)
+
+    vector<vector<Fraqtion>> a; // ограничения
+    vector<Fraqtion> b; // свободные члены
+    vector<Fraqtion> c; // коэффициенты функции
+    vector<ConstraintType> types; // типы ограничений
+    SimplexMode mode = SimplexMode::Max; // режим решения
+
+    int iterationLimit = 0; // лимит итераций (0 - без лимита)
+    double timeLimit = 0; // лимит времени в секундах (0 - без лимита)
+    atomic<bool> cancel{ false }; // запрошена ли отмена
+
+    bool done = false; // решение завершено
+    SolveStatus status = SolveStatus::NotSolved; // состояние решения
+    SimplexSolve solve; // решение (x пуст и f = 0, если status != Optimal)
+    int iterations = 0; // количество итераций
+    double seconds = 0; // время решения
+    bool warm = false; // решение начато с базиса семейства
+};
+
+// служба решения задач: очередь задач, пул рабочих потоков, лимиты, отмена
+// и тёплый старт с последнего оптимального базиса семейства моделей
+class SolverService {
+    mutex lock; // защита очереди, задач и базисов семейств
+    condition_variable queueChanged; // в очереди появилась задача или служба останавливается
+    condition_variable jobDone; // задача завершена
+
+    deque<shared_ptr<ServiceJob>> queue; // задачи, ожидающие решения
+    map<int, shared_ptr<ServiceJob>> jobs; // задачи, результат которых ещё не забран
+    map<int, vector<int>> familyBasis; // последний оптимальный базис семейства
+    map<int, pair<int, int>> familySize; // размеры задачи семейства (n, m), для которых сохранён базис
+
+    vector<thread> workers; // рабочие потоки
+    int nextId; // номер следующей задачи
+    bool stopping; // служба останавливается
+
+    int listener; // слушающий сокет (-1, если служба не принимает соединения)
+    set<int> clients; // открытые соединения клиентов
+
+    void Worker(); // цикл рабочего потока
+    void Run(ServiceJob &job); // решение одной задачи
+    void Finish(const shared_ptr<ServiceJob> &job); // отметка о завершении задачи
+
+    bool ReadInt(int fd, int32_t &value) const; // чтение числа из сокета
+    bool WriteInts(int fd, const vector<int32_t> &values) const; // запись чисел в сокет
+    bool ReadFraqtion(int fd, Fraqtion &value) const; // чтение дроби из сокета
+    bool ReadJob(int fd, ServiceJob &job) const; // чтение задачи из сокета
+    void HandleClient(int fd); // обработка команд одного клиента
+public:
+    SolverService(int workerCount = 4);
+    ~SolverService();
+
+    int Submit(const shared_ptr<ServiceJob> &job); // постановка задачи в очередь
+    shared_ptr<ServiceJob> Wait(int id); // ожидание результата (nullptr, если задачи нет)
+    bool Cancel(int id); // отмена задачи
+    void Stop(); // остановка службы: задачи в очереди отменяются, рабочие потоки завершаются
+
+    bool Serve(const string &path); // приём команд через Unix-сокет до команды Shutdown
+};
+
+SolverService::SolverService(int workerCount) {
+    this->nextId = 1;
+    this->stopping = false;
+    this->listener = -1;
+
+    for (int i = 0; i < workerCount; i++)
+        workers.push_back(thread(&SolverService::Worker, this));
+}
+
+SolverService::~SolverService() {
+    Stop();
+}
+
+// цикл рабочего потока
+void SolverService::Worker() {
+    while (true) {
+        shared_ptr<ServiceJob> job;
+
+        {
+            unique_lock<mutex> guard(lock);
+            queueChanged.wait(guard, [this] { return stopping || !queue.empty(); });
+
+            if (queue.empty())
+                return;
+
+            job = queue.front();
+            queue.pop_front();
+        }
+
+        if (job->cancel)
+            job->status = SolveStatus::Cancelled;
+        else
+            Run(*job);
+
+        Finish(job);
+    }
+}
+
+// решение одной задачи: без вывода таблиц, с лимитами задачи и тёплым стартом семейства
+void SolverService::Run(ServiceJob &job) {
+    Simplex simplex(job.a, job.b, job.c, job.types, job.mode);
+    simplex.SetLimits(job.iterationLimit, job.timeLimit, &job.cancel);
+
+    int n = job.c.size();
+    int m = job.a.size();
+    vector<int> basis;
+
+    {
+        lock_guard<mutex> guard(lock);
+
+        if (job.family >= 0 && familySize.count(job.family) && familySize[job.family] == make_pair(n, m))
+            basis = familyBasis[job.family];
+    }
+
+    auto start = chrono::steady_clock::now();
+    bool result;
+
+    if (!basis.empty()) {
+        simplex.SetStartBasis(basis);
+        result = simplex.Solve(false, CrashMode::User);
+        job.warm = true;
+    }
+    else {
+        result = simplex.Solve(false);
+    }
+
+    job.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    job.iterations = simplex.GetIterations();
+    job.status = simplex.GetStatus();
+
+    if (!result)
+        return;
+
+    job.solve = simplex.GetSolve();
+    job.solve.x.resize(n); // клиенту нужны только основные переменные
+
+    if (job.family >= 0) {
+        lock_guard<mutex> guard(lock);
+        familyBasis[job.family] = simplex.GetBasis();
+        familySize[job.family] = make_pair(n, m);
+    }
+}
+
+// отметка о завершении задачи
+void SolverService::Finish(const shared_ptr<ServiceJob> &job) {
+    lock_guard<mutex> guard(lock);
+    job->done = true;
+    jobDone.notify_all();
+}
+
+// постановка задачи в очередь
+int SolverService::Submit(const shared_ptr<ServiceJob> &job) {
+    lock_guard<mutex> guard(lock);
+
+    if (stopping)
+        return -1;
+
+    job->id = nextId++;
+    job->solve = SimplexSolve();
+    job->solve.f = 0; // значение функции появляется только у найденного решения
+    jobs[job->id] = job;
+    queue.push_back(job);
+    queueChanged.notify_one();
+
+    return job->id;
+}
+
+// ожидание результата: после ответа задача забывается
+shared_ptr<ServiceJob> SolverService::Wait(int id) {
+    unique_lock<mutex> guard(lock);
+
+    if (!jobs.count(id))
+        return nullptr;
+
+    shared_ptr<ServiceJob> job = jobs[id];
+    jobDone.wait(guard, [&job] { return job->done; });
+    jobs.erase(id);
+
+    return job;
+}
+
+// отмена задачи: задача в очереди не запустится, решаемая остановится на ближайшей итерации
+bool SolverService::Cancel(int id) {
+    lock_guard<mutex> guard(lock);
+
+    if (!jobs.count(id))
+        return false;
+
+    jobs[id]->cancel = true;
+    return true;
+}
+
+// остановка службы: задачи в очереди отменяются, рабочие потоки завершаются
+void SolverService::Stop() {
+    {
+        lock_guard<mutex> guard(lock);
+
+        if (stopping && workers.empty())
+            return;
+
+        stopping = true;
+
+        for (auto it = jobs.begin(); it != jobs.end(); it++)
+            it->second->cancel = true;
+
+        queueChanged.notify_all();
+    }
+
+    for (int i = 0; i < workers.size(); i++)
+        workers[i].join();
+
+    workers.clear();
+
+    // задачи, до которых рабочие потоки не дошли
+    lock_guard<mutex> guard(lock);
+
+    for (int i = 0; i < queue.size(); i++) {
+        queue[i]->status = SolveStatus::Cancelled;
+        queue[i]->done = true;
+    }
+
+    queue.clear();
+    jobDone.notify_all();
+}
+
+#ifndef _WIN32
+// чтение числа из сокета
+bool SolverService::ReadInt(int fd, int32_t &value) const {
+    char *data = (char *) &value;
+    int size = 0;
+
+    while (size < sizeof(value)) {
+        ssize_t count = read(fd, data + size, sizeof(value) - size);
+
+        if (count < 0 && errno == EINTR)
+            continue;
+
+        if (count <= 0)
+            return false;
+
+        size += count;
+    }
+
+    return true;
+}
+
+// запись чисел в сокет: false, если клиент ушёл (EPIPE) или соединение сломано
+bool SolverService::WriteInts(int fd, const vector<int32_t> &values) const {
+    const char *data = (const char *) values.data();
+    int total = values.size() * sizeof(int32_t);
+    int size = 0;
+
+    while (size < total) {
+        ssize_t count = send(fd, data + size, total - size, MSG_NOSIGNAL);
+
+        if (count < 0 && errno == EINTR)
+            continue;
+
+        if (count <= 0)
+            return false;
+
+        size += count;
+    }
+
+    return true;
+}
+
+// чтение дроби из сокета
+bool SolverService::ReadFraqtion(int fd, Fraqtion &value) const {
+    int32_t numerator, denominator;
+
+    if (!ReadInt(fd, numerator) || !ReadInt(fd, denominator) || denominator == 0)
+        return false;
+
+    value = Fraqtion(numerator, denominator);
+    return true;
+}
+
+// чтение задачи из сокета
+// формат: семейство, лимит итераций, лимит времени в мс, режим (0 - max, 1 - min), n, m,
+// c (n дробей), затем m строк: тип ограничения, b, a (n дробей)
+bool SolverService::ReadJob(int fd, ServiceJob &job) const {
+    int32_t family, iterationLimit, timeLimit, mode, n, m;
+
+    if (!ReadInt(fd, family) || !ReadInt(fd, iterationLimit) || !ReadInt(fd, timeLimit) || !ReadInt(fd, mode) || !ReadInt(fd, n) || !ReadInt(fd, m))
+        return false;
+
+    // размер проверяется до выделения памяти: ограничена и каждая размерность, и вся таблица
+    if (n <= 0 || m <= 0 || n > SERVICE_SIZE_LIMIT || m > SERVICE_SIZE_LIMIT || (long long) m * (n + m + 1) > SERVICE_CELL_LIMIT)
+        return false;
+
+    job.family = family;
+    job.iterationLimit = iterationLimit;
+    job.timeLimit = timeLimit / 1000.0;
+    job.mode = mode == 0 ? SimplexMode::Max : SimplexMode::Min;
+    job.c = vector<Fraqtion>(n);
+    job.a = vector<vector<Fraqtion>>(m, vector<Fraqtion>(n));
+    job.b = vector<Fraqtion>(m);
+    job.types = vector<ConstraintType>(m);
+
+    for (int j = 0; j < n; j++)
+        if (!ReadFraqtion(fd, job.c[j]))
+            return false;
+
+    for (int i = 0; i < m; i++) {
+        int32_t type;
+
+        if (!ReadInt(fd, type) || type < 0 || type > (int) ConstraintType::Equal || !ReadFraqtion(fd, job.b[i]))
+            return false;
+
+        job.types[i] = (ConstraintType) type;
+
+        for (int j = 0; j < n; j++)
+            if (!ReadFraqtion(fd, job.a[i][j]))
+                return false;
+    }
+
+    return true;
+}
+
+// обработка команд одного клиента до закрытия соединения
+// ответы: Submit - номер задачи (-1 при ошибке); Wait - признак наличия задачи, затем состояние,
+// итерации, время в мкс, тёплый старт, значение функции и n значений переменных
+// (если решение не найдено, то функция 0/1 и значений переменных нет);
+// Cancel и Shutdown - признак успеха; если ответ не доставлен (клиент ушёл), соединение закрывается
+void SolverService::HandleClient(int fd) {
+    int32_t command;
+
+    while (ReadInt(fd, command)) {
+        if (command == (int) ServiceCommand::Submit) {
+            shared_ptr<ServiceJob> job = make_shared<ServiceJob>();
+
+            if (!ReadJob(fd, *job)) {
+                WriteInts(fd, { -1 });
+                break;
+            }
+
+            if (!WriteInts(fd, { Submit(job) }))
+                break;
+        }
+        else if (command == (int) ServiceCommand::Wait) {
+            int32_t id;
+
+            if (!ReadInt(fd, id))
+                break;
+
+            shared_ptr<ServiceJob> job = Wait(id);
+
+            if (!job) {
+                if (!WriteInts(fd, { 0 }))
+                    break;
+
+                continue;
+            }
+
+            vector<int32_t> answer = { 1, (int) job->status, job->iterations, (int) (job->seconds * 1e6), job->warm };
+            answer.push_back(job->solve.f.GetN());
+            answer.push_back(job->solve.f.GetM());
+            answer.push_back(job->solve.x.size());
+
+            for (int j = 0; j < job->solve.x.size(); j++) {
+                answer.push_back(job->solve.x[j].GetN());
+                answer.push_back(job->solve.x[j].GetM());
+            }
+
+            if (!WriteInts(fd, answer))
+                break;
+        }
+        else if (command == (int) ServiceCommand::Cancel) {
+            int32_t id;
+
+            if (!ReadInt(fd, id))
+                break;
+
+            if (!WriteInts(fd, { Cancel(id) }))
+                break;
+        }
+        else if (command == (int) ServiceCommand::Shutdown) {
+            WriteInts(fd, { 1 });
+
+            // прерываем ожидание соединений в Serve
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+            shutdown(listener, SHUT_RDWR);
+
+            break;
+        }
+        else {
+            break;
+        }
+    }
+
+    lock_guard<mutex> guard(lock);
+    clients.erase(fd);
+    close(fd);
+}
+
+// приём команд через Unix-сокет: каждый клиент обслуживается своим потоком,
+// задачи решает общий пул; служба работает до команды Shutdown
+bool SolverService::Serve(const string &path) {
+    listener = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (listener < 0)
+        return false;
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+
+    if (path.size() >= sizeof(address.sun_path)) {
+        close(listener);
+        return false;
+    }
+
+    copy(path.begin(), path.end(), address.sun_path);
+    unlink(path.c_str());
+
+    if (bind(listener, (sockaddr *) &address, sizeof(address)) < 0 || listen(listener, 16) < 0) {
+        close(listener);
+        return false;
+    }
+
+    vector<thread> handlers;
+
+    // accept прерывается командой Shutdown (shutdown слушающего сокета)
+    while (true) {
+        int fd = accept(listener, nullptr, nullptr);
+
+        if (fd < 0)
+            break;
+
+        lock_guard<mutex> guard(lock);
+
+        if (stopping) {
+            close(fd);
+            break;
+        }
+
+#ifdef SO_NOSIGPIPE
+        int noSignal = 1;
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+#endif
+
+        clients.insert(fd);
+        handlers.push_back(thread(&SolverService::HandleClient, this, fd));
+    }
+
+    // отменяем задачи, чтобы ожидающие клиенты получили ответ, затем закрываем соединения
+    Stop();
+
+    {
+        lock_guard<mutex> guard(lock);
+
+        for (auto it = clients.begin(); it != clients.end(); it++)
+            shutdown(*it, SHUT_RDWR);
+
+        close(listener);
+        listener = -1;
+    }
+
+    for (int i = 0; i < handlers.size(); i++)
+        handlers[i].join();
+
+    unlink(path.c_str());
+    return true;
+}
+#else
+// Unix-сокеты в этой сборке недоступны, службой можно пользоваться напрямую (Submit / Wait)
+bool SolverService::Serve(const string &path) {
+    return false;
+}
+#endif
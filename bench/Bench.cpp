@@ -0,0 +1,474 @@
+// сборка: g++ -std=c++17 -O2 -pthread bench/Bench.cpp -o Bench
+// запуск: ./Bench [раздел ...] - без аргументов выполняются все разделы
+// задачи строятся из фиксированных зёрен, поэтому счётчики (итерации, узлы) воспроизводятся точно,
+// а время зависит от машины - в сообщениях коммитов приведены значения на машине автора
+#include <functional>
+#include <sstream>
+#include "../simplex.hpp"
+#include "../FixedSimplex.hpp"
+#include "../tests/Check.hpp"
+
+// подавление вывода решателей на время жизни объекта
+class Silence {
+    ostringstream buffer;
+    streambuf *saved;
+public:
+    Silence() : saved(cout.rdbuf(buffer.rdbuf())) {}
+    ~Silence() { cout.rdbuf(saved); }
+};
+
+// среднее время вызова f в микросекундах по repeats повторам
+double Microseconds(const function<void()> &f, int repeats) {
+    Silence silence;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    for (int i = 0; i < repeats; i++)
+        f();
+
+    return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / repeats;
+}
+
+// число с заданным количеством знаков после запятой
+string Fixed(double value, int precision) {
+    ostringstream s;
+    s << fixed << setprecision(precision) << value;
+    return s.str();
+}
+
+// строка таблицы результатов: подпись и столбцы одинаковой ширины
+void PrintRow(const string &label, const vector<string> &cells) {
+    cout << "  " << left << setw(10) << label << right;
+
+    for (int i = 0; i < cells.size(); i++)
+        cout << setw(16) << cells[i];
+
+    cout << endl;
+}
+
+// crash: итерации (с вводом столбцов crash) и время до оптимума для каждого способа начального базиса;
+// тёплый старт - базис оптимума задачи с соседними правыми частями
+void BenchCrash() {
+    cout << "crash: pivots / us per solve on feasible mixed <=, >=, = models (30 per size)" << endl;
+    PrintRow("n x m", { "Slack", "Triangular", "InteriorPoint", "User (warm)" });
+
+    for (int size : { 6, 9, 12 }) {
+        const int models = 30;
+        CrashMode modes[] = { CrashMode::Slack, CrashMode::Triangular, CrashMode::InteriorPoint, CrashMode::User };
+        double pivots[4] = { 0 }, times[4] = { 0 };
+
+        for (int seed = 0; seed < models; seed++) {
+            LpTask task = FeasibleTask(seed, size, size);
+
+            // тёплый базис берём из задачи с правыми частями, сдвинутыми на единицу
+            LpTask neighbour = task;
+
+            for (int i = 0; i + 1 < size; i++)
+                if (neighbour.types[i] == ConstraintType::LessEqual)
+                    neighbour.b[i] += 1;
+
+            Simplex donor = neighbour.Build();
+            donor.Solve(false);
+
+            for (int mode = 0; mode < 4; mode++) {
+                Simplex simplex = task.Build();
+                simplex.SetStartBasis(donor.GetBasis());
+
+                if (!simplex.Solve(false, modes[mode]))
+                    cout << "  model " << seed << ": " << (int) modes[mode] << " crash did not reach the optimum" << endl;
+
+                pivots[mode] += simplex.GetIterations();
+
+                times[mode] += Microseconds([&]() {
+                    Simplex timed = task.Build();
+                    timed.SetStartBasis(donor.GetBasis());
+                    timed.Solve(false, modes[mode]);
+                }, 20);
+            }
+        }
+
+        vector<string> cells;
+
+        for (int mode = 0; mode < 4; mode++)
+            cells.push_back(Fixed(pivots[mode] / models, 1) + " / " + Fixed(times[mode] / models, 0));
+
+        PrintRow(to_string(size) + "x" + to_string(size), cells);
+    }
+
+    cout << endl;
+}
+
+// метод внутренней точки против симплекса: время, итерации, точность значения функции без crossover
+// и итерации симплекса после crossover; модели с переполнением дробей симплекса не учитываются
+void BenchInteriorPoint() {
+    cout << "ipm: us per solve (iterations) on dense max models, 20 per size, [k] solved without Fraqtion overflow" << endl;
+    PrintRow("n x m", { "Simplex", "IPM", "IPM+crossover", "max |dF|/|F|" });
+
+    for (int size : { 6, 12, 20, 30 }) {
+        double times[3] = { 0 }, iterations[3] = { 0 }, error = 0;
+        int models = 0;
+
+        for (int seed = 0; seed < 20; seed++) {
+            LpTask task = RandomTask(seed, size + size / 3, size);
+
+            Simplex exact = task.Build();
+
+            if (!exact.Solve(false))
+                continue;
+
+            Simplex ipm = task.Build();
+            SimplexSolve solve = ipm.SolveInteriorPoint(false);
+
+            Simplex crossover = task.Build();
+            crossover.Solve(false, CrashMode::InteriorPoint);
+
+            models++;
+            iterations[0] += exact.GetIterations();
+            iterations[1] += ipm.GetIterations();
+            iterations[2] += crossover.GetIterations();
+
+            double f = exact.GetSolve().f.ToDouble();
+            error = max(error, fabs(solve.f.ToDouble() - f) / fabs(f));
+
+            times[0] += Microseconds([&]() { task.Build().Solve(false); }, 10);
+            times[1] += Microseconds([&]() { task.Build().SolveInteriorPoint(false); }, 10);
+            times[2] += Microseconds([&]() { task.Build().Solve(false, CrashMode::InteriorPoint); }, 10);
+        }
+
+        vector<string> cells;
+
+        for (int i = 0; i < 3; i++)
+            cells.push_back(Fixed(times[i] / models, 0) + " (" + Fixed(iterations[i] / models, 1) + ")");
+
+        ostringstream accuracy;
+        accuracy << setprecision(1) << scientific << error;
+        cells.push_back(accuracy.str());
+
+        PrintRow(to_string(size + size / 3) + "x" + to_string(size) + " [" + to_string(models) + "]", cells);
+    }
+
+    cout << endl;
+}
+
+// решение в double с точной проверкой базиса против точного симплекса: время и итерации Solve, время
+// SolveVerified и точные итерации после непрошедшей проверки, доля подтверждённых базисов; проверяется
+// совпадение значения функции. Плотные задачи max, a·x <= b и смешанные (FeasibleTask) с первой фазой
+void BenchVerified() {
+    cout << "verified: us per solve (exact pivots) on N x N models, 20 per size, [k] solved exactly without Fraqtion overflow" << endl;
+    PrintRow("N", { "kind", "Solve", "SolveVerified", "certified", "F mismatch" });
+
+    for (int kind = 0; kind < 2; kind++) {
+        for (int size : { 8, 16, 24 }) {
+            double times[2] = { 0 }, pivots[2] = { 0 };
+            int models = 0, certified = 0, mismatches = 0;
+
+            for (int seed = 0; seed < 20; seed++) {
+                LpTask task = kind == 0 ? RandomTask(seed, size, size) : FeasibleTask(seed, size, size);
+
+                Simplex verified = task.Build();
+                SimplexSolve solve = verified.SolveVerified(false);
+                certified += solve.certified;
+
+                Simplex exact = task.Build();
+
+                if (!exact.Solve(false))
+                    continue;
+
+                models++;
+                mismatches += solve.x.empty() || solve.f != exact.GetSolve().f;
+                pivots[0] += exact.GetIterations();
+                pivots[1] += solve.exactPivots;
+
+                times[0] += Microseconds([&]() { task.Build().Solve(false); }, 10);
+                times[1] += Microseconds([&]() { task.Build().SolveVerified(false); }, 10);
+            }
+
+            vector<string> cells = { kind == 0 ? "dense" : "mixed" };
+
+            for (int i = 0; i < 2; i++)
+                cells.push_back(models ? Fixed(times[i] / models, 0) + " (" + Fixed(pivots[i] / models, 1) + ")" : "-");
+
+            cells.push_back(to_string(certified) + " / 20");
+            cells.push_back(to_string(mismatches));
+
+            PrintRow(to_string(size) + " [" + to_string(models) + "]", cells);
+        }
+    }
+
+    cout << endl;
+}
+
+// целочисленная задача N x N без случайности: a[i][j] = (7i + 3j) mod 5 + 1
+LpTask IntegerTask(int size) {
+    LpTask task;
+
+    for (int i = 0; i < size; i++) {
+        vector<Fraqtion> row(size);
+
+        for (int j = 0; j < size; j++)
+            row[j] = (i * 7 + j * 3) % 5 + 1;
+
+        task.a.push_back(row);
+        task.b.push_back(10 + i);
+        task.types.push_back(ConstraintType::LessEqual);
+    }
+
+    for (int j = 0; j < size; j++)
+        task.c.push_back(j % 4 + 1);
+
+    return task;
+}
+
+// целочисленная таблица (Бареисс) против дробной: время на целочисленных задачах и
+// доля случайных дробных задач, которые каждый путь довёл до конца без переполнения
+void BenchBareiss() {
+    cout << "bareiss: us per solve on the integer N x N model" << endl;
+    PrintRow("N", { "Fraqtion", "fraction-free", "pivots" });
+
+    for (int size : { 8, 20, 40 }) {
+        LpTask task = IntegerTask(size);
+        Simplex simplex = task.Build();
+        simplex.Solve(false);
+
+        double rational = Microseconds([&]() { task.Build().Solve(false); }, 200);
+        double fractionFree = Microseconds([&]() { task.Build().Solve(false, CrashMode::Slack, true); }, 200);
+
+        PrintRow(to_string(size), { Fixed(rational, 0), Fixed(fractionFree, 0), to_string(simplex.GetIterations()) });
+    }
+
+    cout << "bareiss: random fractional models (100 per size) finished without Overflow" << endl;
+    PrintRow("N", { "Fraqtion", "fraction-free" });
+
+    for (int size : { 4, 6, 8, 10 }) {
+        int finished[2] = { 0 };
+
+        for (int seed = 0; seed < 100; seed++) {
+            LpTask task = RandomTask(seed, size, size, FractionalShape(size / 2));
+
+            for (int path = 0; path < 2; path++) {
+                Simplex simplex = task.Build();
+                simplex.Solve(false, CrashMode::Slack, path == 1);
+                finished[path] += simplex.GetStatus() != SolveStatus::Overflow;
+            }
+        }
+
+        PrintRow(to_string(size), { to_string(finished[0]), to_string(finished[1]) });
+    }
+
+    cout << endl;
+}
+
+// правила ветвления: узлы и время ветвей и границ на случайных ЦЛП (плотные задачи max, a·x <= b);
+// проверяется, что полные поиски всех правил приходят к одному рекорду,
+// поиски с прерванными LP (например, Overflow) считаются отдельно
+void BenchBranching() {
+    const int models = 20;
+
+    cout << "branching: mean nodes / ms per search on dense n x (n + 1) ILPs (" << models << " per size, DownFirst)" << endl;
+    PrintRow("n x m", { "MostFractional", "Pseudocost", "Strong", "Pseudocost+cuts" });
+
+    for (int size : { 5, 7, 9 }) {
+        double nodes[4] = { 0 }, times[4] = { 0 };
+        int mismatches = 0, incomplete = 0;
+
+        for (int seed = 0; seed < models; seed++) {
+            LpTask task = RandomTask(seed, size, size + 1);
+            Fraqtion best;
+            bool hasBest = false;
+
+            for (int rule = 0; rule < 4; rule++) {
+                BranchingState state;
+                state.rule = rule == 3 ? BranchingRule::Pseudocost : (BranchingRule) rule;
+                state.cuts = rule == 3;
+
+                times[rule] += Microseconds([&]() {
+                    Simplex simplex = task.Build();
+                    simplex.SolveIntegerBranchesAndBorders(state, false);
+                }, 1) / 1000;
+
+                nodes[rule] += state.nodes;
+
+                if (state.stoppedNodes > 0)
+                    incomplete++;
+                else if (!hasBest) {
+                    best = state.incumbent;
+                    hasBest = true;
+                }
+                else {
+                    mismatches += state.incumbent != best;
+                }
+            }
+        }
+
+        vector<string> cells;
+
+        for (int rule = 0; rule < 4; rule++)
+            cells.push_back(Fixed(nodes[rule] / models, 1) + " / " + Fixed(times[rule] / models, 2));
+
+        PrintRow(to_string(size) + "x" + to_string(size + 1), cells);
+
+        if (incomplete > 0)
+            cout << "  " << incomplete << " search(es) incomplete: a node LP stopped (BranchingState::stopStatus)" << endl;
+
+        if (mismatches > 0)
+            cout << "  " << mismatches << " complete search(es) ended with a different incumbent" << endl;
+    }
+
+    cout << endl;
+}
+
+// FixedSimplex против Simplex: наносекунды на построение и решение демонстрационной задачи main.cpp
+// и случайных задач 5 x 4 в обоих режимах; проверяется совпадение значения функции и числа итераций
+void BenchFixed() {
+    LpTask demo;
+    demo.a = { { 4, 1, 1 }, { 1, 2, 0 }, { 0, Fraqtion(1, 2), 1 } };
+    demo.b = { 4, 3, 2 };
+    demo.c = { 7, 5, 3 };
+    demo.types = vector<ConstraintType>(3, ConstraintType::LessEqual);
+
+    vector<LpTask> tasks;
+
+    for (int seed = 0; seed < 200; seed++) {
+        LpTask task = RandomTask(seed, 5, 4);
+        task.mode = seed % 2 ? SimplexMode::Min : SimplexMode::Max;
+
+        for (int j = 0; j < 5; j++)
+            task.c[j] -= 4; // в min нужны и отрицательные коэффициенты, иначе оптимум - ноль
+
+        tasks.push_back(task);
+    }
+
+    int mismatches = 0;
+
+    for (const LpTask &task : tasks) {
+        Simplex simplex = task.Build();
+        FixedSimplex<5, 4> fixed = BuildFixed<5, 4>(task);
+
+        bool result = simplex.Solve(false);
+        mismatches += result != fixed.Solve() || (result && (simplex.GetSolve().f != fixed.GetF() || simplex.GetIterations() != fixed.GetIterations()));
+    }
+
+    volatile int sink = 0; // значения функции накапливаются, чтобы решение не было выброшено оптимизатором
+
+    double demoSimplex = Microseconds([&]() { Simplex simplex = demo.Build(); simplex.Solve(false); sink = sink + simplex.GetSolve().f.GetN(); }, 20000);
+    double demoFixed = Microseconds([&]() { FixedSimplex<3, 3> fixed = BuildFixed<3, 3>(demo); fixed.Solve(); sink = sink + fixed.GetF().GetN(); }, 20000);
+
+    double randomSimplex = Microseconds([&]() {
+        for (const LpTask &task : tasks) {
+            Simplex simplex = task.Build();
+            simplex.Solve(false);
+            sink = sink + simplex.GetIterations();
+        }
+    }, 20) / tasks.size();
+
+    double randomFixed = Microseconds([&]() {
+        for (const LpTask &task : tasks) {
+            FixedSimplex<5, 4> fixed = BuildFixed<5, 4>(task);
+            fixed.Solve();
+            sink = sink + fixed.GetIterations();
+        }
+    }, 20) / tasks.size();
+
+    cout << "fixed: ns per build + solve" << endl;
+    PrintRow("model", { "Simplex", "FixedSimplex" });
+    PrintRow("demo 3x3", { Fixed(demoSimplex * 1000, 0), Fixed(demoFixed * 1000, 0) });
+    PrintRow("random 5x4", { Fixed(randomSimplex * 1000, 0), Fixed(randomFixed * 1000, 0) });
+    cout << "  " << tasks.size() << " random models (max and min), " << mismatches << " differ in result, F or iterations" << endl << endl;
+}
+
+// задача заданного вида с n переменными и m строками, коэффициенты от 1 до 4:
+// 0 - покрытие min c·x, a·x >= b; 1 - упаковка max c·x, a·x <= b;
+// 2 и 3 - смешанные <=, >=, = по целой точке (FeasibleTask) на max и на min
+LpTask ShapedTask(int seed, int kind, int n, int m) {
+    if (kind >= 2) {
+        LpTask task = FeasibleTask(seed, n, m);
+        task.mode = kind == 2 ? SimplexMode::Max : SimplexMode::Min;
+
+        return task;
+    }
+
+    TaskShape shape;
+    shape.high = shape.costHigh = 4;
+    shape.rhsLow = 5;
+    shape.rhsHigh = 20;
+    shape.greaterEqual = kind == 0 ? 1 : 0;
+    shape.mode = kind == 0 ? SimplexMode::Min : SimplexMode::Max;
+
+    return RandomTask(seed, n, m, shape);
+}
+
+// прямая и двойственная формулировки: миллисекунды на решение (Solve, SolveDual, SolveAuto) по 20 задачам
+// каждого вида и размера n x m (переменные x строки); проверяется совпадение состояния и значения функции, а для SolveAuto -
+// попала ли выбранная формулировка на более быструю
+void BenchDual() {
+    const char *kinds[] = { "cover", "pack", "mixed max", "mixed min" };
+    int shapes[][2] = { { 6, 40 }, { 5, 100 }, { 40, 6 }, { 12, 12 } };
+    const int models = 20;
+    int hits = 0, mixes = 0, mismatches = 0;
+    double worst = 1;
+
+    cout << "dual: ms per solve, " << models << " models per kind and n x m shape (variables x rows)" << endl;
+    PrintRow("n x m", { "kind", "primal", "dual", "auto", "auto chose" });
+
+    for (auto &shape : shapes) {
+        for (int kind = 0; kind < 4; kind++) {
+            double times[3] = { 0 };
+            int dualChoices = 0;
+
+            for (int seed = 0; seed < models; seed++) {
+                LpTask task = ShapedTask(seed, kind, shape[0], shape[1]);
+                SimplexSolve dualSolve, autoSolve;
+
+                Simplex primal = task.Build();
+                Simplex dual = task.Build();
+                Simplex automatic = task.Build();
+
+                bool primalResult;
+                times[0] += Microseconds([&]() { primalResult = primal.Solve(false); }, 1) / 1000;
+                times[1] += Microseconds([&]() { dual.SolveDual(dualSolve, false); }, 1) / 1000;
+                times[2] += Microseconds([&]() { automatic.SolveAuto(autoSolve, false); }, 1) / 1000;
+
+                dualChoices += automatic.ChooseFormulation() == Formulation::Dual;
+
+                // сравниваются только доказанные ответы: переполнение дробей в одной из формулировок не ошибка
+                if (primal.GetStatus() != SolveStatus::Overflow && dual.GetStatus() != SolveStatus::Overflow)
+                    mismatches += primal.GetStatus() != dual.GetStatus() || (primalResult && primal.GetSolve().f != dualSolve.f);
+            }
+
+            bool dualFaster = times[1] < times[0];
+            bool choseDual = dualChoices * 2 > models;
+
+            mixes++;
+            hits += dualFaster == choseDual;
+            worst = max(worst, times[2] / min(times[0], times[1]));
+
+            PrintRow(to_string(shape[0]) + "x" + to_string(shape[1]), { kinds[kind], Fixed(times[0] / models, 2), Fixed(times[1] / models, 2), Fixed(times[2] / models, 2), choseDual ? "dual" : "primal" });
+        }
+    }
+
+    cout << "  auto chose the faster formulation in " << hits << " of " << mixes << " mixes, worst auto / best = " << Fixed(worst, 2) << endl;
+    cout << "  " << mismatches << " model(s) with different status or F between primal and dual" << endl << endl;
+}
+
+int main(int argc, char **argv) {
+    vector<pair<string, function<void()>>> sections = {
+        { "crash", BenchCrash },
+        { "ipm", BenchInteriorPoint },
+        { "verified", BenchVerified },
+        { "bareiss", BenchBareiss },
+        { "branching", BenchBranching },
+        { "fixed", BenchFixed },
+        { "dual", BenchDual }
+    };
+
+    for (auto &section : sections) {
+        bool selected = argc == 1;
+
+        for (int i = 1; i < argc; i++)
+            selected = selected || section.first == argv[i];
+
+        if (selected)
+            section.second();
+    }
+
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <vector>
+#include <cstdlib>
 #include "Simplex.hpp"
+#include "SolverService.hpp"
 
 using namespace std;
 
@@ -44,7 +46,13 @@ void Gomory(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const
         simplex.PrintSolve(solves[0]); // выводим решение
 }
 
-int main() {
+int main(int argc, char **argv) {
+    // режим службы: main --daemon <путь к сокету> [число рабочих потоков]
+    if (argc >= 3 && string(argv[1]) == "--daemon") {
+        SolverService service(argc >= 4 ? atoi(argv[3]) : 4);
+        return service.Serve(argv[2]) ? 0 : 1;
+    }
+
     vector<vector<Fraqtion>> a = {
         { 4, 1, 1 },
         { 1, 2, 0 },
@@ -5,23 +5,171 @@
 #include <vector>
 #include <cmath>
 #include <string>
+#include <fstream>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <chrono>
+#include <atomic>
+#include <cstdio>
 #include "Fraqtion.hpp"
+#include "InteriorPoint.hpp"
+#include "CutPool.hpp"
+#include "LpCache.hpp"
+#include "SimplexMode.hpp"
 
 using namespace std;
 
 const Fraqtion INF(1, 0); // бесконечность
 const Fraqtion EPS(0, 1); // точность
 
-// тип симплекс решения
-enum class SimplexMode {
-    Max,
-    Min
+const int TABLE_SAFE_LIMIT = 1000000; // предел числителей и знаменателей таблицы при добавлении отсечений
+
+const char SNAPSHOT_MAGIC[4] = { 'S', 'M', 'P', 'X' }; // сигнатура файла снимка
+const int32_t SNAPSHOT_VERSION = 1; // версия формата снимка
+const int SNAPSHOT_SIZE_LIMIT = 100000; // наибольшие n, m и число начальных ограничений в снимке
+const long long SNAPSHOT_CELL_LIMIT = 10000000; // наибольшее число клеток таблицы и начальных условий в снимке
+
+const char BRANCHING_MAGIC[4] = { 'S', 'M', 'B', 'B' }; // сигнатура файла снимка ветвей и границ
+const int32_t BRANCHING_VERSION = 1; // версия формата снимка ветвей и границ
+
+// тип ограничения
+enum class ConstraintType {
+    LessEqual, // a·x <= b
+    GreaterEqual, // a·x >= b
+    Equal // a·x = b
+};
+
+// состояние последнего решения
+enum class SolveStatus {
+    NotSolved, // решение не запускалось
+    Optimal, // найден оптимальный план
+    Infeasible, // ограничения несовместны
+    Unbounded, // функция не ограничена
+    IterationLimit, // исчерпан лимит итераций
+    TimeLimit, // исчерпан лимит времени
+    Cancelled, // решение отменено
+    Overflow // дроби таблицы переполнили int, план недостоверен
+};
+
+// способ построения начального базиса
+enum class CrashMode {
+    Slack, // базис из балансовых переменных
+    Triangular, // треугольный базис из основных переменных
+    User, // базис, заданный пользователем (SetStartBasis / LoadBasis)
+    InteriorPoint // базис из решения метода внутренней точки (crossover)
+};
+
+// формулировка, в которой решается задача
+enum class Formulation {
+    Primal, // прямая задача
+    Dual // двойственная задача
+};
+
+// оценка трудоёмкости решения задачи в одной из формулировок
+struct FormulationEstimate {
+    int rows = 0; // строк таблицы
+    int columns = 0; // столбцов таблицы: основные, балансовые и искусственные переменные
+    int artificials = 0; // искусственных переменных первой фазы
+    int nonzeros = 0; // ненулевых коэффициентов ограничений
+    double work = 0; // оценка числа операций с дробями
+};
+
+// правило выбора переменной для ветвления
+enum class BranchingRule {
+    MostFractional, // наибольшая дробная часть
+    Pseudocost, // псевдостоимости с инициализацией сильным ветвлением
+    Strong // ограниченное сильное ветвление
+};
+
+// порядок обхода дочерних задач
+enum class ChildOrder {
+    DownFirst, // сначала x <= [x]
+    UpFirst, // сначала x >= [x] + 1
+    Nearest // сначала к ближайшему целому
 };
 
 // структура для решения
 struct SimplexSolve {
     vector<Fraqtion> x;
     Fraqtion f;
+
+    bool certified = false; // вещественный базис подтверждён точной проверкой
+    int exactPivots = 0; // точные итерации, понадобившиеся после проверки
+};
+
+// ограничение a·x <= b или a·x >= b, добавленное к корневой задаче на пути к узлу (граница ветвления или отсечение)
+struct BranchRow {
+    vector<Fraqtion> a;
+    Fraqtion b = 0;
+    ConstraintType type = ConstraintType::LessEqual;
+};
+
+// элемент стека обхода ветвей и границ: задача (корневая с добавленными ограничениями) либо
+// отложенное обновление псевдостоимостей, которое лежит под дочерними задачами и выполняется после них
+struct BranchingNode {
+    bool update = false; // обновление псевдостоимостей вместо задачи
+    int depth = 0; // глубина узла
+    string path; // путь от корня: '0' - ветка вверх, '1' - вниз (задаёт порядок выдачи решений)
+    vector<BranchRow> rows; // ограничения, добавленные к корневой задаче на пути к узлу
+    int parent = -1; // позиция обновления родителя в стеке (-1 у корня)
+
+    // обновление: переменная ветвления, дробная часть её значения, функция родителя и дочерних задач
+    int index = -1;
+    Fraqtion fraction = 0;
+    Fraqtion f = 0;
+    bool downSolved = false, upSolved = false;
+    Fraqtion downF = 0, upF = 0;
+};
+
+// настройки и статистика метода ветвей и границ
+struct BranchingState {
+    BranchingRule rule = BranchingRule::MostFractional;
+    ChildOrder order = ChildOrder::DownFirst;
+    int reliability = 2; // число наблюдений, после которого псевдостоимость надёжна
+    int strongIterations = 3; // число двойственных итераций на кандидата
+    int strongCandidates = 8; // число кандидатов для сильного ветвления
+
+    // псевдостоимости: сумма ухудшений функции на единицу сдвига и число наблюдений
+    vector<double> downSum, upSum;
+    vector<int> downCount, upCount;
+
+    bool hasIncumbent = false; // найдено ли целочисленное решение
+    Fraqtion incumbent; // значение лучшего целочисленного решения
+    int nodes = 0; // количество решённых узлов
+    int incumbentNode = 0; // узел, на котором найдено лучшее решение
+    double incumbentSeconds = 0; // время до лучшего решения
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    // ветви и отсечения
+    bool cuts = false; // добавлять ли отсечения в узлах
+    int rootCutRounds = 5; // раунды отсечений в корне
+    int localCutRounds = 1; // раунды отсечений в остальных узлах
+    int maxCutAge = 3; // сколько раундов неактивное отсечение хранится в пуле
+    int maxCutsPerRound = 5; // сколько самых нарушенных отсечений добавлять за раунд
+    CutPool pool; // глобальный пул отсечений
+    int cutsAdded = 0; // количество добавленных в узлы отсечений
+    int stoppedNodes = 0; // узлы, LP которых прервано (лимит, отмена, переполнение), - поиск неполный
+    SolveStatus stopStatus = SolveStatus::NotSolved; // причина последней такой остановки
+
+    // эвристики поиска целочисленных решений
+    bool heuristics = false; // запускать ли эвристики (в корне и каждые heuristicFrequency узлов)
+    int heuristicFrequency = 10; // период запуска эвристик по узлам (0 и меньше - только в корне)
+    int maxDiveDepth = 20; // предельная глубина ныряния
+    int pumpIterations = 20; // итерации насоса допустимости
+    vector<Fraqtion> incumbentX; // лучшее целочисленное решение
+    string incumbentSource; // кто нашёл лучшее решение
+    int firstIncumbentNode = 0; // узел, на котором найдено первое решение
+    double firstIncumbentSeconds = 0; // время до первого решения
+    string firstIncumbentSource; // кто нашёл первое решение
+
+    LpCache *cache = nullptr; // кэш LP-релаксаций узлов (может быть общим для нескольких запусков)
+
+    // приостановка и продолжение поиска (SaveBranching / LoadBranching)
+    int pauseNodes = 0; // после стольких узлов за вызов поиск приостанавливается (0 - без паузы)
+    const atomic<bool> *pause = nullptr; // флаг приостановки из другого потока
+    vector<BranchingNode> pending; // стек обхода (пуст - поиск завершён или не начат)
+    vector<pair<string, SimplexSolve>> found; // найденные решения с ключом порядка выдачи
 };
 
 class Simplex {
@@ -29,15 +177,31 @@ class Simplex {
     SimplexMode mode; // режим решения
     int n; // количество переменных
     int m; // количество ограничений
+    int k; // количество искусственных переменных (только на первой фазе)
 
     vector<int> basis; // базис
     vector<Fraqtion> deltas; // дельты
     vector<vector<Fraqtion>> table; // таблица
+    vector<ConstraintType> types; // типы ограничений (после приведения к b >= 0)
 
     // начальные условия
     vector<vector<Fraqtion>> initialA;
     vector<Fraqtion> initialC;
     vector<Fraqtion> initialB;
+    vector<ConstraintType> initialTypes;
+
+    vector<int> startBasis; // начальный базис, заданный пользователем
+    int iterations; // количество выполненных преобразований Гаусса
+    bool solved; // найдено ли оптимальное решение последним Solve
+    SolveStatus status; // состояние последнего решения
+    int iterationLimit; // лимит итераций решения (0 - без лимита)
+    double timeLimit; // лимит времени решения в секундах (0 - без лимита)
+    const atomic<bool> *cancel; // флаг отмены решения из другого потока
+    chrono::steady_clock::time_point solveStart; // начало последнего решения
+    bool fractionFree; // итерации в целочисленной таблице без сокращения дробей
+    long long fractionFreeDenominator; // знаменатель целочисленной таблицы по цепочке ведущих элементов (0 - неизвестен)
+    vector<int> verifiedBasis; // базис, подтверждённый SolveVerified без перестройки таблицы (пуст, если ответ в таблице)
+    SimplexSolve verifiedSolve; // решение для этого базиса
 
     int padding; // отступ
 
@@ -45,10 +209,6 @@ class Simplex {
     void PrintHeader() const;
     void PrintLine() const;
 
-    int GetNegativeRowB(); // получение строки с максимальным по модулю отрицательным значением b
-    int GetNegativeColumnB(int row); // получение столбца с максимальным по модулю элементом в строке
-    bool RemoveNegativeB(); // удаление отрицательных элементов в b
-
     void DivideRow(int row, Fraqtion value); // деление строки на число
     void SubstractRow(int row1, int row2, Fraqtion value); // вычитание строки row2 * value из row1
     void Gauss(int row, int column); // исключение гаусса
@@ -62,30 +222,148 @@ class Simplex {
 
     int GetSolveColumn(); // получение разрешающего столбца
     int GetSolveRow(const vector<Fraqtion> &q); // получение разрешающей строки
-    SimplexSolve GetSolve(); // получение решения
+    bool LimitReached(); // исчерпан ли лимит итераций или времени, отменено ли решение, переполнились ли дроби
+    void PrintStatus() const; // вывод причины, по которой решение не найдено
+
+    bool Optimize(bool debug); // итерации симплекс-метода до оптимального плана
+    bool OptimizeFractionFree(bool debug); // те же итерации в целочисленной таблице (Бареисс), при переполнении - в дробях
+    bool IterateFractionFree(bool debug, bool &result); // итерации в целочисленной таблице (false, если числа не поместились)
+    bool StoreFractionFree(const vector<vector<long long>> &t, long long d); // запись целочисленной таблицы в дроби
+    bool ToLong(__int128 value, long long &result) const; // перевод 128-битного числа в long long с проверкой диапазона
+    bool PhaseOne(bool debug); // первая фаза: поиск допустимого базиса
+    void NormalizeRows(); // приведение свободных членов к неотрицательным
+    bool NeedsArtificial(int row) const; // нужна ли строке искусственная переменная
+    bool NeedsArtificial(ConstraintType type, Fraqtion b) const; // нужна ли искусственная переменная ограничению с правой частью b
+    void CrashTriangular(); // треугольный crash по основным переменным
+    void CrashBasis(const vector<int> &columns); // ввод в базис заданных столбцов
+    bool CrashInteriorPoint(bool debug); // crossover: базис из решения метода внутренней точки
+
+    InteriorPoint BuildInteriorPoint() const; // задача для метода внутренней точки по текущей таблице
+    Fraqtion ToFraqtion(double value) const; // приближение вещественного числа дробью
+
+    void GaussDouble(vector<vector<double>> &t, vector<int> &db, int row, int column) const; // исключение Гаусса в вещественной таблице
+    bool OptimizeDouble(vector<vector<double>> &t, vector<int> &db, const vector<double> &cost, int columns) const; // симплекс-итерации в вещественной таблице
+    bool CertifyBasis(const vector<int> &columns, SimplexSolve &solve) const; // точная проверка базиса по LU-разложению его матрицы
+    vector<int> SolveDoubleBasis() const; // поиск оптимального базиса в вещественной арифметике
+    void RemoveArtificial(); // удаление искусственных переменных из таблицы
 
     int GetRealIndex(const vector<Fraqtion> &x); // получение индекса вещественного решения
+    int GetBranchIndex(const SimplexSolve &solve, BranchingState &state); // выбор переменной для ветвления
+    double StrongBranch(int index, bool up, int limit) const; // оценка ухудшения функции в дочерней задаче
+    bool DualIterations(int limit); // итерации двойственного симплекс-метода
+    void AddRow(const vector<Fraqtion> &row, Fraqtion b); // добавление ограничения row·x <= b к текущей таблице
+    void AddStructuralRow(const vector<Fraqtion> &a, Fraqtion b); // добавление ограничения a·x <= b по основным переменным
+
+    bool IsIntegerColumn(int column) const; // целочисленна ли переменная
+    Fraqtion Floor(Fraqtion x) const; // округление вниз
+    Fraqtion Violation(const Cut &cut, const vector<Fraqtion> &x) const; // нарушение отсечения в точке x
+    bool ToStructural(const vector<Fraqtion> &alpha, Fraqtion beta, Cut &cut) const; // перевод отсечения из таблицы в основные переменные
+    vector<Fraqtion> GomoryRow(int row) const; // смешанно-целочисленное отсечение Гомори по строке таблицы
+    void SeparateGomory(vector<Cut> &cuts) const; // отсечения Гомори в основных переменных
+    void SeparateMir(const vector<Fraqtion> &x, vector<Cut> &cuts) const; // MIR-отсечения по строкам ограничений
+    void SeparateCover(const vector<Fraqtion> &x, vector<Cut> &cuts) const; // расширенные покрытия рюкзачных строк
+    bool IsTableSafe() const; // не грозит ли таблице переполнение дробей
+    bool CutRounds(BranchingState &state, int rounds, bool global); // раунды отсечений в узле
+
+    bool IsBetter(Fraqtion f, const BranchingState &state) const; // лучше ли значение функции текущего рекорда
+    void UpdateIncumbent(const SimplexSolve &solve, BranchingState &state, const string &source) const; // обновление рекорда
+    bool TryHeuristicSolve(const vector<Fraqtion> &x, BranchingState &state, const string &source, vector<SimplexSolve> &solves) const; // проверка точки, найденной эвристикой
+    bool CanRound(int column, bool up) const; // не нарушит ли округление переменной ни одной строки
+    void SimpleRounding(const SimplexSolve &solve, BranchingState &state, vector<SimplexSolve> &solves) const; // безопасное округление
+    void ShiftRounding(const SimplexSolve &solve, BranchingState &state, vector<SimplexSolve> &solves) const; // округление со сдвигами
+    void Diving(BranchingState &state, bool guided, vector<SimplexSolve> &solves) const; // дробное и направленное ныряние
+    void FeasibilityPump(const SimplexSolve &solve, BranchingState &state, vector<SimplexSolve> &solves) const; // насос допустимости
+    vector<SimplexSolve> RunHeuristics(const SimplexSolve &solve, BranchingState &state, bool root) const; // запуск эвристик в узле
+
+    void WriteInts(ostream &os, const vector<int> &v) const; // запись целых чисел в снимок
+    void WriteFraqtions(ostream &os, const vector<Fraqtion> &v) const; // запись дробей в снимок
+    bool ReadInts(istream &is, vector<int> &v, int count) const; // чтение целых чисел из снимка
+    bool ReadFraqtions(istream &is, vector<Fraqtion> &v, int count) const; // чтение дробей из снимка
+    bool ReadHeader(istream &is, vector<int> &sizes) const; // чтение заголовка снимка
+    bool ReadBasis(istream &is, vector<int> &v, int count, int columns) const; // чтение базиса снимка с проверкой номеров
+    bool ReadTypes(istream &is, vector<ConstraintType> &v, int count) const; // чтение типов ограничений снимка
+    void WriteDoubles(ostream &os, const vector<double> &v) const; // запись вещественных чисел в снимок
+    void WriteString(ostream &os, const string &s) const; // запись строки в снимок (длина и символы)
+    bool ReadDoubles(istream &is, vector<double> &v, int count) const; // чтение вещественных чисел из снимка
+    bool ReadString(istream &is, string &s) const; // чтение строки из снимка
+    bool ReadCount(istream &is, int &count, int limit) const; // чтение количества элементов из [0, limit]
+    bool ReadRange(istream &is, int &value, int low, int high) const; // чтение числа из [low, high]
+    void WriteNode(ostream &os, const BranchingNode &node) const; // запись элемента стека обхода
+    void WriteSolve(ostream &os, const SimplexSolve &solve) const; // запись найденного решения
+    bool ReadRow(istream &is, BranchRow &row, int columns) const; // чтение ограничения узла
+    bool ReadNode(istream &is, BranchingNode &node, int columns) const; // чтение элемента стека обхода
+    bool ReadSolve(istream &is, SimplexSolve &solve, int limit) const; // чтение найденного решения (не больше limit значений)
+
+    uint64_t HashCombine(uint64_t hash, int value) const; // добавление числа к хешу FNV-1a
+    uint64_t RowHash(int row) const; // хеш начального ограничения
+    vector<int> CanonicalRows() const; // начальные ограничения в канонической нумерации (по хешу)
+    vector<int32_t> CacheProblem() const; // каноническая запись задачи для кэша LP-релаксаций
+    bool SolveFromCache(const LpCacheEntry &entry, bool debug); // решение по записи кэша
+    void StoreInCache(LpCache &cache, const vector<int32_t> &problem, bool result) const; // сохранение результата решения в кэш
+    void CountStopped(BranchingState &state) const; // учёт узла, решение которого прервано, а не доказано пустым
+    void SolveBranchingNode(const BranchingNode &node, BranchingState &state, bool debug); // решение задачи из стека обхода
+    void BranchNode(const BranchingNode &node, BranchingState &state, bool debug); // решение задачи узла и ветвление
+    void FinishBranching(const BranchingNode &node, BranchingState &state) const; // обновление псевдостоимостей после дочерних задач
 public:
     Simplex(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const vector<Fraqtion> &c, SimplexMode mode, int padding = 0);
+    Simplex(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const vector<Fraqtion> &c, const vector<ConstraintType> &types, SimplexMode mode, int padding = 0);
 
+    Simplex GetDual() const; // двойственная задача по начальным условиям
     void ConvertToDual(); // перевод в двойственную
     void PrintTable() const; // вывод таблицы
     void PrintTask() const; // вывод задачи
     void PrintSolve(SimplexSolve solve) const; // вывод решения
-    bool Solve(bool debug = true); // решение задачи
+    bool Solve(bool debug = true, CrashMode crash = CrashMode::Slack, bool fractionFree = false); // решение задачи
+
+    void SetStartBasis(const vector<int> &basis); // задание начального базиса
+    bool LoadBasis(const string &path); // загрузка начального базиса из файла
+    bool SaveBasis(const string &path) const; // сохранение текущего базиса в файл
+    int GetIterations() const; // количество итераций последнего решения
+    void SetLimits(int iterationLimit, double timeLimit, const atomic<bool> *cancel = nullptr); // лимиты решения и флаг отмены
+    SolveStatus GetStatus() const; // состояние последнего решения
+    SimplexSolve GetSolve(); // получение решения
+    vector<int> GetBasis() const; // текущий базис
+
+    SimplexSolve SolveInteriorPoint(bool debug = false); // решение методом внутренней точки без crossover (состояние - в GetStatus)
+    SimplexSolve SolveVerified(bool debug = false); // решение в double с точной проверкой базиса (состояние - в GetStatus)
+
+    bool SaveSnapshot(const string &path) const; // сохранение состояния в бинарный снимок
+    bool LoadSnapshot(const string &path); // восстановление состояния из снимка
+    bool LoadSnapshotBasis(const string &path); // загрузка только базиса из снимка (тёплый старт)
+    bool SolveCached(LpCache &cache, bool debug = false); // решение с кэшем LP-релаксаций
+
+    FormulationEstimate EstimateFormulation(Formulation formulation) const; // оценка трудоёмкости формулировки
+    Formulation ChooseFormulation() const; // выбор формулировки по размерам, разреженности и знакам правых частей
+    bool SolveDual(SimplexSolve &solve, bool debug = false); // решение через двойственную задачу с переводом ответа в прямые переменные
+    bool SolveAuto(SimplexSolve &solve, bool debug = false); // решение в формулировке, выбранной ChooseFormulation
 
     vector<SimplexSolve> SolveIntegerBranchesAndBorders(bool debug = false, int depth = 0); // получение целочисленных решений
+    vector<SimplexSolve> SolveIntegerBranchesAndBorders(BranchingState &state, bool debug = false, int depth = 0); // то же с выбором правила ветвления
+    bool SaveBranching(const string &path, const BranchingState &state) const; // сохранение приостановленного поиска
+    bool LoadBranching(const string &path, BranchingState &state); // восстановление задачи и поиска для продолжения
     vector<SimplexSolve> SolveIntegerBruteforce(int nmax); // поиск решений методом грубой силы
     vector<SimplexSolve> SolveGomory(bool debug = false); // поиск решения методом Гомори
 
     void FindBestSolve(const vector<SimplexSolve> &solves) const; // поиск лучшего из решений
 };
 
-Simplex::Simplex(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const vector<Fraqtion> &c, SimplexMode mode, int padding) {
+Simplex::Simplex(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const vector<Fraqtion> &c, SimplexMode mode, int padding) : Simplex(a, b, c, vector<ConstraintType>(a.size(), ConstraintType::LessEqual), mode, padding) {
+}
+
+Simplex::Simplex(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const vector<Fraqtion> &c, const vector<ConstraintType> &types, SimplexMode mode, int padding) {
     this->mode = mode;
 
     this->n = a[0].size(); // считаем количество основных переменных
     this->m = a.size(); // считаем количество ограничений
+    this->k = 0; // искусственные переменные появляются только на первой фазе
+    this->iterations = 0;
+    this->fractionFree = false;
+    this->fractionFreeDenominator = 0;
+    this->solved = false;
+    this->status = SolveStatus::NotSolved;
+    this->iterationLimit = 0;
+    this->timeLimit = 0;
+    this->cancel = nullptr;
     this->padding = padding; // запоминаем значение отступа
 
     // добавляем базисные переменные
@@ -99,20 +377,38 @@ Simplex::Simplex(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, c
     }
 
     for (int i = 0; i < m; i++) {
+        ConstraintType type = types[i];
+        Fraqtion sign = 1;
+
+        // приводим строку к неотрицательному свободному члену (a·x >= 0 удобнее как -a·x <= 0)
+        if (b[i] < 0 || (b[i] == 0 && type == ConstraintType::GreaterEqual)) {
+            sign = -1;
+
+            if (type == ConstraintType::LessEqual)
+                type = ConstraintType::GreaterEqual;
+            else if (type == ConstraintType::GreaterEqual)
+                type = ConstraintType::LessEqual;
+        }
+
         this->table.push_back(vector<Fraqtion>(n + m + 1, 0)); // добавляем строку в таблицу
+        this->types.push_back(type);
 
         for (int j = 0; j < n; j++)
-            this->table[i][j] = a[i][j]; // копируем основные ограничения
+            this->table[i][j] = a[i][j] * sign; // копируем основные ограничения
 
-        for (int j = 0; j < m; j++)
-            this->table[i][j + n] = i == j; // добавляем единичную матрицу
+        // добавляем балансовую переменную: +1 для <=, -1 для >=, у равенства столбец пустой
+        if (type == ConstraintType::LessEqual)
+            this->table[i][n + i] = 1;
+        else if (type == ConstraintType::GreaterEqual)
+            this->table[i][n + i] = -1;
 
-        this->table[i][n + m] = b[i]; // копируем свободный член
+        this->table[i][n + m] = b[i] * sign; // копируем свободный член
     }
 
     initialA = vector<vector<Fraqtion>>(a);
     initialB = vector<Fraqtion>(b);
     initialC = vector<Fraqtion>(c);
+    initialTypes = vector<ConstraintType>(types);
 }
 
 void Simplex::PrintVector(const vector<Fraqtion> &v) const {
@@ -126,7 +422,7 @@ void Simplex::PrintHeader() const {
     cout << string(padding, ' ');
     cout << "|  basis  |";
 
-    for (int i = 0; i < n + m; i++) {
+    for (int i = 0; i < n + m + k; i++) {
         string s = "x";
         s += to_string(i + 1);
 
@@ -139,7 +435,7 @@ void Simplex::PrintHeader() const {
 void Simplex::PrintLine() const {
     cout << string(padding, ' ');
     cout << "+---------+";
-    for (int i = 0; i < n + m + 1; i++)
+    for (int i = 0; i < n + m + k + 1; i++)
         cout << "-----------+";
     cout << endl;
 }
@@ -192,7 +488,14 @@ void Simplex::PrintTask() const {
             wasPrinted = true;
         }
 
-        cout << " <= " << table[i][n + m] << endl;
+        if (types[i] == ConstraintType::LessEqual)
+            cout << " <= ";
+        else if (types[i] == ConstraintType::GreaterEqual)
+            cout << " >= ";
+        else
+            cout << " = ";
+
+        cout << table[i][n + m] << endl;
     }
 }
 
@@ -215,56 +518,37 @@ void Simplex::PrintTable() const {
     PrintLine();
 }
 
-// получение строки с максимальным по модулю отрицательным значением b
-int Simplex::GetNegativeRowB() {
-    int index = -1;
-
-    for (int i = 0; i < m; i++) {
-        Fraqtion bi = table[i][n + m];
-
-        if ((bi < 0) && (index == -1 || bi < table[index][n + m]))
-            index = i;
-    }
-
-    return index;
-}
-
-// получение столбца с максимальным по модулю элементом в строке
-int Simplex::GetNegativeColumnB(int row) {
-    int index = -1;
-
-    for (int i = 0; i < n + m; i++) {
-        if (table[row][i] >= 0)
-            continue;
-
-        if (index == -1 || fabs(table[row][i]) > fabs(table[row][index]))
-            index = i;
-    }
-
-    return index;
-}
-
 // деление строки на число
 void Simplex::DivideRow(int row, Fraqtion value) {
-    for (int i = 0; i < n + m + 1; i++)
+    for (int i = 0; i < n + m + k + 1; i++)
         table[row][i] /= value;
 }
 
 // вычитание строки row2 * value из row1
 void Simplex::SubstractRow(int row1, int row2, Fraqtion value) {
-    for (int i = 0; i < n + m + 1; i++)
+    for (int i = 0; i < n + m + k + 1; i++)
         table[row1][i] -= table[row2][i] * value;
 }
 
 // исключение гаусса
 void Simplex::Gauss(int row, int column) {
+    // шаг в дробях между целочисленными итерациями продолжает их цепочку: знаменатель умножается на ведущий элемент
+    if (fractionFreeDenominator != 0) {
+        Fraqtion pivot = table[row][column];
+        __int128 value = fractionFreeDenominator % pivot.GetM() == 0 ? (__int128) (fractionFreeDenominator / pivot.GetM()) * pivot.GetN() : 0;
+
+        if (!ToLong(value < 0 ? -value : value, fractionFreeDenominator))
+            fractionFreeDenominator = 0;
+    }
+
     DivideRow(row, table[row][column]);
 
     for (int i = 0; i < m; i++)
-        if (i != row)
+        if (i != row && table[i][column] != 0) // нулевой множитель строку не меняет
             SubstractRow(i, row, table[i][column]);
 
     basis[row] = column; // меняем базисный элемент
+    iterations++;
 }
 
 // получение дробной части
@@ -272,24 +556,6 @@ Fraqtion Simplex::Part(Fraqtion x) const {
     return x.GetRealPart();
 }
 
-// удаление отрицательных элементов в b
-bool Simplex::RemoveNegativeB() {
-    int row = GetNegativeRowB();
-
-    // пока есть отрицательные элементы
-    while (row != -1) {
-        int column = GetNegativeColumnB(row); // получение столбца
-
-        if (column == -1) // если не нашли
-            return false; // значит нельзя избавиться
-
-        Gauss(row, column); // выполняем исключение Гауса
-        row = GetNegativeRowB(); // получаем следующую строку с отрицательным b
-    }
-
-    return true; // всё удалили
-}
-
 // базисная ли переменная
 bool Simplex::IsBasis(int index) const {
     for (int i = 0; i < m; i++)
@@ -301,7 +567,7 @@ bool Simplex::IsBasis(int index) const {
 
 // проверка плана на оптимальность
 bool Simplex::IsOptimal() {
-    for (int i = 0; i < n + m; i++) {
+    for (int i = 0; i < n + m + k; i++) {
         if (mode == SimplexMode::Max && deltas[i] < 0)
             return false;
 
@@ -314,14 +580,21 @@ bool Simplex::IsOptimal() {
 
 // подходит ли решение по условию
 bool Simplex::CheckSolve(const vector<Fraqtion> x) const {
-    for (int i = 0; i < m; i++) {
+    for (int i = 0; i < initialA.size(); i++) {
         Fraqtion sum = 0;
 
         for (int j = 0; j < n; j++)
-            sum += table[i][j] * x[j];
+            sum += initialA[i][j] * x[j];
+
+        // если не выполнено ограничение, то решение не подходит
+        if (initialTypes[i] == ConstraintType::LessEqual && sum > initialB[i])
+            return false;
+
+        if (initialTypes[i] == ConstraintType::GreaterEqual && sum < initialB[i])
+            return false;
 
-        if (sum > table[i][n + m]) // если не выполнено ограничение
-            return false; // то решение не подходит
+        if (initialTypes[i] == ConstraintType::Equal && sum != initialB[i])
+            return false;
     }
 
     return true; // решение подходит
@@ -329,7 +602,7 @@ bool Simplex::CheckSolve(const vector<Fraqtion> x) const {
 
 // расчёт дельт
 void Simplex::CalculateDeltas() {
-    for (int i = 0; i < n + m + 1; i++) {
+    for (int i = 0; i < n + m + k + 1; i++) {
         deltas[i] = -c[i];
 
         for (int j = 0; j < m; j++)
@@ -346,11 +619,11 @@ vector<Fraqtion> Simplex::CalculateSimplexRelations(int columnIndex) {
             q.push_back(INF);
         }
         else {
-            if (table[i][n + m] >= 0 && table[i][columnIndex] < 0) {
+            if (table[i][n + m + k] >= 0 && table[i][columnIndex] < 0) {
                 q.push_back(INF);
             }
             else {
-                q.push_back(table[i][n + m] / table[i][columnIndex]);
+                q.push_back(table[i][n + m + k] / table[i][columnIndex]);
             }
         }
     }
@@ -362,7 +635,7 @@ vector<Fraqtion> Simplex::CalculateSimplexRelations(int columnIndex) {
 int Simplex::GetSolveColumn() {
     int column = 0;
 
-    for (int i = 0; i < n + m; i++) {
+    for (int i = 0; i < n + m + k; i++) {
         if (mode == SimplexMode::Max && deltas[i] < deltas[column]) {
             column = i;
         }
@@ -387,6 +660,10 @@ int Simplex::GetSolveRow(const vector<Fraqtion> &q) {
 
 // получение решения
 SimplexSolve Simplex::GetSolve() {
+    // решение, подтверждённое SolveVerified, в таблицу не переносилось
+    if (!verifiedBasis.empty())
+        return verifiedSolve;
+
     SimplexSolve solve;
     solve.x = vector<Fraqtion>(n + m, 0);
     solve.f = deltas[n + m];
@@ -398,205 +675,3119 @@ SimplexSolve Simplex::GetSolve() {
     return solve; // возвращаем решение
 }
 
-// перевод в двойственную
+// двойственная задача по начальным условиям: ограничения приводятся к виду a·x <= b для max
+// (a·x >= b для min), каждому соответствует неотрицательная двойственная переменная, а равенству -
+// разность двух неотрицательных; каждой основной переменной соответствует ограничение двойственной
+Simplex Simplex::GetDual() const {
+    ConstraintType natural = mode == SimplexMode::Max ? ConstraintType::LessEqual : ConstraintType::GreaterEqual;
+    ConstraintType dualType = mode == SimplexMode::Max ? ConstraintType::GreaterEqual : ConstraintType::LessEqual;
+
+    vector<vector<Fraqtion>> a(n); // строка j - ограничение двойственной для переменной x_j
+    vector<Fraqtion> b(initialC); // правые части - коэффициенты функции прямой задачи
+    vector<Fraqtion> c; // функция - правые части прямой задачи
+
+    for (int i = 0; i < initialA.size(); i++) {
+        Fraqtion sign = initialTypes[i] == natural || initialTypes[i] == ConstraintType::Equal ? 1 : -1;
+        int copies = initialTypes[i] == ConstraintType::Equal ? 2 : 1; // свободная переменная равенства = y+ - y-
+
+        for (int copy = 0; copy < copies; copy++) {
+            Fraqtion columnSign = copy == 0 ? sign : -sign;
+
+            for (int j = 0; j < n; j++)
+                a[j].push_back(initialA[i][j] * columnSign);
+
+            c.push_back(initialB[i] * columnSign);
+        }
+    }
+
+    SimplexMode dualMode = mode == SimplexMode::Max ? SimplexMode::Min : SimplexMode::Max;
+    return Simplex(a, b, c, vector<ConstraintType>(n, dualType), dualMode, padding);
+}
+
+// перевод в двойственную (решение двойственной переводится в прямые переменные в SolveDual)
 void Simplex::ConvertToDual() {
-    mode = mode == SimplexMode::Max ? SimplexMode::Min : SimplexMode::Max; // меняем режим
+    *this = GetDual();
+}
 
-    for (int i = 0; i < n; i++) {
-        Fraqtion ci = c[i];
-        c[i] = table[i][n + m];
-        table[i][n + m] = -ci;
+// оценка трудоёмкости формулировки: второй фазе нужно порядка min(строк, основных переменных) итераций,
+// каждая искусственная переменная добавляет первой фазе примерно две; итерация меняет строки
+// с ненулевым элементом в разрешающем столбце (их доля - заполненность ограничений), а цена строки -
+// число ненулевых элементов в ней: основные по заполненности и балансовые, заполняемые с каждым базисом
+FormulationEstimate Simplex::EstimateFormulation(Formulation formulation) const {
+    FormulationEstimate estimate;
+    int structural = 0; // основных переменных в формулировке
 
-        for (int j = i + 1; j < n; j++)
-            swap(table[i][j], table[j][i]);
+    if (formulation == Formulation::Primal) {
+        estimate.rows = initialA.size();
+        structural = n;
 
-        for (int j = 0; j < n + m; j++)
-            table[i][j] *= -1;
+        for (int i = 0; i < initialA.size(); i++) {
+            estimate.artificials += NeedsArtificial(initialTypes[i], initialB[i]);
+
+            for (int j = 0; j < n; j++)
+                estimate.nonzeros += initialA[i][j] != 0;
+        }
+    }
+    else {
+        ConstraintType dualType = mode == SimplexMode::Max ? ConstraintType::GreaterEqual : ConstraintType::LessEqual;
+        estimate.rows = n;
+
+        for (int i = 0; i < initialA.size(); i++) {
+            int copies = initialTypes[i] == ConstraintType::Equal ? 2 : 1;
+            structural += copies;
+
+            for (int j = 0; j < n; j++)
+                estimate.nonzeros += copies * (initialA[i][j] != 0);
+        }
+
+        for (int j = 0; j < n; j++)
+            estimate.artificials += NeedsArtificial(dualType, initialC[j]);
     }
+
+    estimate.columns = structural + estimate.rows + estimate.artificials;
+
+    double density = (double) estimate.nonzeros / (estimate.rows * structural);
+    double pivots = min(estimate.rows, structural) + 2 * estimate.artificials;
+    double touchedRows = 1 + density * (estimate.rows - 1);
+    double rowNonzeros = density * structural + min((double) estimate.rows, pivots) + 1;
+
+    estimate.work = pivots * touchedRows * rowNonzeros;
+
+    return estimate;
 }
 
-// решение задачи
-bool Simplex::Solve(bool debug) {
-    if (!RemoveNegativeB()) {
-        cout << string(padding, ' ') << "Solve does not exists" << endl << endl;
-        return false;
+// выбор формулировки: двойственная, если её оценка трудоёмкости меньше
+Formulation Simplex::ChooseFormulation() const {
+    if (EstimateFormulation(Formulation::Dual).work < EstimateFormulation(Formulation::Primal).work)
+        return Formulation::Dual;
+
+    return Formulation::Primal;
+}
+
+// решение через двойственную задачу: x_j - двойственная оценка ограничения j двойственной задачи,
+// она равна дельте его балансового столбца (со знаком минус, если двойственная решается на min)
+bool Simplex::SolveDual(SimplexSolve &solve, bool debug) {
+    Simplex dual = GetDual();
+    dual.SetLimits(iterationLimit, timeLimit, cancel);
+
+    if (debug) {
+        cout << string(padding, ' ') << "Dual task:" << endl;
+        dual.PrintTask();
+        cout << endl;
+    }
+
+    bool result = dual.Solve(debug);
+    iterations = dual.iterations;
+    status = dual.status;
+    solved = false; // таблица прямой задачи не менялась
+    verifiedBasis.clear();
+
+    // дроби двойственной задачи переполнились - её ответу верить нельзя, решаем прямую
+    if (status == SolveStatus::Overflow) {
+        result = Solve(debug);
+
+        if (result)
+            solve = GetSolve();
+
+        return result;
+    }
+
+    if (!result) {
+        // неограниченность двойственной означает несовместность прямой
+        if (status == SolveStatus::Unbounded)
+            status = SolveStatus::Infeasible;
+
+        // при несовместной двойственной прямая либо несовместна, либо не ограничена - различает только она сама
+        if (status == SolveStatus::Infeasible && dual.status == SolveStatus::Infeasible) {
+            result = Solve(debug);
+
+            if (result)
+                solve = GetSolve();
+        }
+
+        return result;
+    }
+
+    int rows = initialA.size();
+    Fraqtion sign = dual.mode == SimplexMode::Min ? -1 : 1;
+
+    solve = SimplexSolve();
+    solve.x = vector<Fraqtion>(n + rows, 0);
+    solve.f = dual.deltas[dual.n + dual.m]; // по теореме двойственности значения функций совпадают
+
+    for (int j = 0; j < n; j++)
+        solve.x[j] = dual.deltas[dual.n + j] * sign;
+
+    // балансовые переменные прямой задачи восстанавливаются по ограничениям
+    for (int i = 0; i < rows; i++) {
+        Fraqtion rest = initialB[i];
+
+        for (int j = 0; j < n; j++)
+            rest -= initialA[i][j] * solve.x[j];
+
+        if (initialTypes[i] == ConstraintType::LessEqual)
+            solve.x[n + i] = rest;
+        else if (initialTypes[i] == ConstraintType::GreaterEqual)
+            solve.x[n + i] = -rest;
     }
 
+    // восстановление балансовых переменных тоже могло переполниться - тогда решаем прямую
+    if (Fraqtion::overflow) {
+        result = Solve(debug);
+
+        if (result)
+            solve = GetSolve();
+
+        return result;
+    }
+
+    if (debug)
+        PrintSolve(solve);
+
+    return true;
+}
+
+// решение в формулировке, выбранной ChooseFormulation
+bool Simplex::SolveAuto(SimplexSolve &solve, bool debug) {
+    Formulation formulation = ChooseFormulation();
+
     if (debug) {
-        cout << string(padding, ' ') << "Initial table:" << endl;
-        CalculateDeltas(); // расчитываем дельты
-        PrintTable();
+        FormulationEstimate primal = EstimateFormulation(Formulation::Primal);
+        FormulationEstimate dual = EstimateFormulation(Formulation::Dual);
+
+        cout << string(padding, ' ') << "Primal: " << primal.rows << "x" << primal.columns << " table, " << primal.artificials << " artificial, work " << primal.work << endl;
+        cout << string(padding, ' ') << "Dual: " << dual.rows << "x" << dual.columns << " table, " << dual.artificials << " artificial, work " << dual.work << endl;
+        cout << string(padding, ' ') << "Solving " << (formulation == Formulation::Dual ? "dual" : "primal") << " task" << endl << endl;
     }
 
+    if (formulation == Formulation::Dual)
+        return SolveDual(solve, debug);
+
+    bool result = Solve(debug);
+
+    if (result)
+        solve = GetSolve();
+
+    return result;
+}
+
+// итерации симплекс-метода до оптимального плана
+bool Simplex::Optimize(bool debug) {
+    if (fractionFree)
+        return OptimizeFractionFree(debug);
+
     for (int iteration = 1; true; iteration++) {
+        if (LimitReached())
+            return false;
+
         CalculateDeltas(); // расчитываем дельты
-        
+
         if (debug) {
             cout << endl << string(padding, ' ') << "Iteration " << iteration << endl;
             PrintTable();
         }
 
         // проверка плана на оптимальность, если оптимален, то решение найдено
-        if (IsOptimal()) {
-            if (debug)
-                PrintSolve(GetSolve());
-
-            return true; // решение есть
-        }
+        if (IsOptimal())
+            return true;
 
         int column = GetSolveColumn(); // получаем разрешающий столбец
         vector<Fraqtion> q = CalculateSimplexRelations(column); // рассчитываем симлекс-отношения
         int row = GetSolveRow(q); // получаем разрешающую строку
 
-        // если нет разрешающей строки, то решения нет
-        if (row == -1) {
-            cout << string(padding, ' ') << "Solve does not exist" << endl << endl;
+        // если нет разрешающей строки, то функция не ограничена
+        if (row == -1)
             return false;
-        }
 
         Gauss(row, column); // выполняем исключение Гауса
     }
 }
 
-// получение индекса вещественного решения
-int Simplex::GetRealIndex(const vector<Fraqtion> &x) {
-    int imax = -1;
-    for (int i = 0; i < n; i++) {
-        if (x[i].IsInteger()) // если не совпадает с целой частью
-            continue;
+// запись целочисленной таблицы t / d обратно в дроби (одно сокращение на клетку);
+// false, если сокращённая дробь не помещается в int (таблица при этом записана не полностью)
+bool Simplex::StoreFractionFree(const vector<vector<long long>> &t, long long d) {
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n + m + k + 1; j++) {
+            long long gcd = std::gcd(t[i][j], d);
+            long long numerator = t[i][j] / gcd;
+            long long denominator = d / gcd;
 
-        if (imax == -1 || x[imax].GetRealPart() < x[i].GetRealPart())
-            imax = i;
+            if (numerator > INT_MAX || numerator < -INT_MAX || denominator > INT_MAX)
+                return false;
+
+            table[i][j] = Fraqtion((int) numerator, (int) denominator);
+        }
     }
 
-    return imax; // нет такого
+    CalculateDeltas();
+    return true;
 }
 
-// получение целочисленных решений
-vector<SimplexSolve> Simplex::SolveIntegerBranchesAndBorders(bool debug, int depth) {
-    cout << string(padding, ' ') << "Start solving task:" << endl;
-    PrintTask();
+// перевод 128-битного числа в long long с проверкой диапазона
+bool Simplex::ToLong(__int128 value, long long &result) const {
+    if (value > LLONG_MAX || value < -LLONG_MAX)
+        return false;
 
-    // если решение не было найдено, то добавляем пустое решение
-    if (!Solve(debug))
-        return {};
+    result = (long long) value;
+    return true;
+}
 
-    SimplexSolve solve = GetSolve(); // получаем решение
-    PrintSolve(solve);
-    cout << endl;
+// итерации симплекс-метода в целочисленной таблице; если числа не поместились в long long,
+// то итерации повторяются в дробях с исходной таблицы
+bool Simplex::OptimizeFractionFree(bool debug) {
+    vector<vector<Fraqtion>> savedTable = table;
+    vector<int> savedBasis = basis;
+    int savedIterations = iterations;
+    bool result;
 
-    int realIndex = GetRealIndex(solve.x); // ищем вещественное решение
+    if (IterateFractionFree(debug, result))
+        return result;
 
-    // если решение содержало только целые числа, то возвращаем решение
-    if (realIndex == -1) {
-        return { solve };
+    if (debug)
+        cout << string(padding, ' ') << "Fraction-free table overflow, continue with fractions" << endl;
+
+    table = savedTable;
+    basis = savedBasis;
+    iterations = savedIterations;
+    fractionFree = false; // остальные фазы этого решения тоже идут в дробях
+    fractionFreeDenominator = 0;
+
+    return Optimize(debug);
+}
+
+// итерации в целочисленной таблице (Эдмондс-Бареисс): таблица хранится как t / d, где d - определитель
+// базиса целочисленной задачи. Шаг даёт t' = (t * pivot - factor * t[row]) / d, деление точное (по тождеству
+// Сильвестра числители - миноры), и новым знаменателем становится сам ведущий элемент, так что ни НОД,
+// ни сокращение клеток на шаге не нужны. Начальный d - продолжение цепочки прошлых итераций этого решения
+// (через первую фазу и шаги Гаусса между фазами), а без неё - произведение НОК знаменателей строк: строки,
+// умноженные на свои НОК, - целочисленная задача с диагональным базисом. Переполнения проверяются,
+// произведения при необходимости считаются в 128 битах; если число не помещается в long long или деление
+// оказалось неточным, возвращается false. Правила выбора те же, что в Optimize, поэтому последовательность
+// базисов и результат совпадают с дробной таблицей
+bool Simplex::IterateFractionFree(bool debug, bool &result) {
+    int width = n + m + k + 1;
+    int last = n + m + k; // столбец свободных членов
+
+    long long d = fractionFreeDenominator;
+
+    // цепочка прошлых итераций годится, только если таблица с ней целочисленна
+    for (int i = 0; i < m && d != 0; i++)
+        for (int j = 0; j < width && d != 0; j++)
+            if (d % table[i][j].GetM() != 0)
+                d = 0;
+
+    if (d == 0) {
+        d = 1;
+
+        for (int i = 0; i < m; i++) {
+            long long scale = 1; // НОК знаменателей строки
+
+            for (int j = 0; j < width; j++) {
+                long long denominator = table[i][j].GetM();
+
+                if (!ToLong((__int128) (scale / std::gcd(scale, denominator)) * denominator, scale))
+                    return false;
+            }
+
+            if (!ToLong((__int128) d * scale, d))
+                return false;
+        }
     }
 
-    Fraqtion b = solve.x[realIndex].GetIntPart(); // получаем новое условие
-    
-    // готовим новые условия
-    vector<vector<Fraqtion>> a1 = initialA;
-    vector<vector<Fraqtion>> a2 = initialA;
+    vector<vector<long long>> t(m, vector<long long>(width));
 
-    vector<Fraqtion> b1 = initialB;
-    vector<Fraqtion> b2 = initialB;
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < width; j++)
+            if (!ToLong((__int128) (d / table[i][j].GetM()) * table[i][j].GetN(), t[i][j]))
+                return false;
 
-    a1.push_back(vector<Fraqtion>(n, 0));
-    a1[m][realIndex] = 1;
-    b1.push_back(b);
+    // целевая функция, умноженная на общий знаменатель коэффициентов
+    long long costScale = 1;
+    vector<long long> cost(width);
 
-    a2.push_back(vector<Fraqtion>(n, 0));
-    a2[m][realIndex] = -1;
-    b2.push_back(-b - 1);
+    for (int j = 0; j < width; j++) {
+        long long denominator = c[j].GetM();
 
-    // разбиваем задачу на 2 ветки решения
-    Simplex simplex1(a1, b1, initialC, mode, padding + 6);
-    Simplex simplex2(a2, b2, initialC, mode, padding + 6);
+        if (!ToLong((__int128) (costScale / std::gcd(costScale, denominator)) * denominator, costScale))
+            return false;
+    }
 
-    cout << string(padding, ' ') << "Divide to tasks: x" << (realIndex + 1) << " <= " << b << " and x" << (realIndex + 1) << " >= " << (b + 1) << endl;
+    for (int j = 0; j < width; j++)
+        if (!ToLong((__int128) (costScale / c[j].GetM()) * c[j].GetN(), cost[j]))
+            return false;
 
-    // запускаем решение для каждой ветки
-    vector<SimplexSolve> solve1 = simplex1.SolveIntegerBranchesAndBorders(debug, depth + 1);
-    vector<SimplexSolve> solve2 = simplex2.SolveIntegerBranchesAndBorders(debug, depth + 1);
-    vector<SimplexSolve> solves;
+    vector<__int128> deltas(width); // дельты, умноженные на d * costScale
 
-    solves.insert(solves.begin(), solve1.begin(), solve1.end());
-    solves.insert(solves.begin(), solve2.begin(), solve2.end());
+    for (int iteration = 1; true; iteration++) {
+        if (LimitReached()) {
+            result = false;
+            fractionFreeDenominator = d;
+            return StoreFractionFree(t, d);
+        }
 
-    return solves; // возвращаем решения
-}
+        for (int j = 0; j < width; j++) {
+            deltas[j] = -(__int128) cost[j] * d;
 
-// поиск решений методом грубой силы
-vector<SimplexSolve> Simplex::SolveIntegerBruteforce(int nmax) {
-    vector<SimplexSolve> solves;
-    cout << "Bruteforce solves: " << endl;
+            for (int i = 0; i < m; i++)
+                if (__builtin_add_overflow(deltas[j], (__int128) cost[basis[i]] * t[i][j], &deltas[j]))
+                    return false;
+        }
 
-    for (int x1 = 0; x1 <= nmax; x1++) {
-        for (int x2 = 0; x2 <= nmax; x2++) {
-            for (int x3 = 0; x3 <= nmax; x3++) {
-                SimplexSolve solve;
-                solve.x = { x1, x2, x3 };
+        // таблица печатается, только если её дроби помещаются в int (иначе она дописывается в конце)
+        if (debug && StoreFractionFree(t, d)) {
+            cout << endl << string(padding, ' ') << "Iteration " << iteration << endl;
+            PrintTable();
+        }
 
-                if (!CheckSolve(solve.x)) // если решение не подходит под ограничения
-                    continue; // то пропускаем
+        int column = 0;
+        bool optimal = true;
 
-                solve.f = 0;
+        for (int j = 0; j < last; j++) {
+            if ((mode == SimplexMode::Max && deltas[j] < 0) || (mode == SimplexMode::Min && deltas[j] > 0))
+                optimal = false;
 
-                for (int i = 0; i < n; i++)
-                    solve.f += c[i] * solve.x[i]; // считаем значение функции
+            if ((mode == SimplexMode::Max && deltas[j] < deltas[column]) || (mode == SimplexMode::Min && deltas[j] > deltas[column]))
+                column = j;
+        }
 
-                PrintSolve(solve);
-                solves.push_back(solve); // добавляем решение
-            }
+        if (optimal) {
+            result = true;
+            fractionFreeDenominator = d;
+            return StoreFractionFree(t, d);
         }
-    }
 
-    return solves; // возвраащем решения
-}
+        // симплекс-отношения t[i][last] / t[i][column] сравниваем перекрёстным умножением
+        int row = -1;
 
-// поиск решения методом Гомори
-vector<SimplexSolve> Simplex::SolveGomory(bool debug) {
-    cout << string(padding, ' ') << "Start solving task:" << endl;
-    PrintTask();
+        for (int i = 0; i < m; i++) {
+            if (t[i][column] <= 0)
+                continue;
 
-    // если решение не было найдено, то добавляем пустое решение
-    if (!Solve(debug))
-        return {};
+            if (row == -1 || (__int128) t[i][last] * t[row][column] < (__int128) t[row][last] * t[i][column])
+                row = i;
+        }
 
-    SimplexSolve solve = GetSolve(); // получаем решение
-    PrintSolve(solve);
-    cout << endl;
+        // если нет разрешающей строки, то функция не ограничена
+        if (row == -1) {
+            result = false;
+            fractionFreeDenominator = d;
+            return StoreFractionFree(t, d);
+        }
 
-    int realIndex = GetRealIndex(solve.x); // ищем вещественное решение
+        long long pivot = t[row][column]; // положителен, поэтому и следующий знаменатель положителен
 
-    // если решение содержало только целые числа, то возвращаем решение
-    if (realIndex == -1)
-        return { solve };
+        // ведущая строка не меняется: её числители над новым знаменателем pivot те же
+        for (int i = 0; i < m; i++) {
+            if (i == row)
+                continue;
 
-    table.push_back(vector<Fraqtion>(n + m + 2, 0));
+            long long factor = t[i][column];
 
-    // ищем строку с этой базисной переменной
-    int index = 0;
-    while (basis[index] != realIndex)
-        index++;
+            for (int j = 0; j < width; j++) {
+                long long product, value;
 
-    // копируем текущую таблицу
-    for (int i = 0; i < m; i++) {
-        table[i].push_back(table[i][n + m]);
-        table[i][n + m] = 0;
-    }
+                // обычно всё помещается в 64 бита, 128-битная арифметика нужна только при переполнении
+                if (!__builtin_mul_overflow(t[i][j], pivot, &value) && !__builtin_mul_overflow(factor, t[row][j], &product) && !__builtin_sub_overflow(value, product, &value)) {
+                    t[i][j] = value / d;
 
-    for (int i = 0; i < n + m; i++)
-        table[m][i] = IsBasis(i) ? 0 : -Part(table[index][i]);
+                    if (t[i][j] * d != value)
+                        return false;
 
-    table[m][n + m] = 1;
-    table[m][n + m + 1] = -Part(solve.x[realIndex]);
+                    continue;
+                }
 
-    c.push_back(0);
-    deltas.push_back(0);
-    basis.push_back(realIndex);
+                __int128 wide;
 
-    m++;
+                if (__builtin_sub_overflow((__int128) t[i][j] * pivot, (__int128) factor * t[row][j], &wide) || wide % d != 0 || !ToLong(wide / d, t[i][j]))
+                    return false;
+            }
+        }
+
+        d = pivot;
+        basis[row] = column;
+        iterations++;
+    }
+}
+
+// удаление искусственных переменных из таблицы
+void Simplex::RemoveArtificial() {
+    for (int i = 0; i < m; i++)
+        table[i].erase(table[i].begin() + n + m, table[i].begin() + n + m + k);
+
+    deltas.resize(n + m + 1);
+    k = 0;
+}
+
+// приведение свободных членов к неотрицательным: строку с отрицательным b умножаем на -1
+void Simplex::NormalizeRows() {
+    for (int i = 0; i < m; i++)
+        if (table[i][n + m] < 0)
+            for (int j = 0; j < n + m + 1; j++)
+                table[i][j] = -table[i][j];
+}
+
+// нужна ли строке искусственная переменная
+bool Simplex::NeedsArtificial(int row) const {
+    return table[row][n + m] < 0 || table[row][basis[row]] != 1;
+}
+
+// нужна ли искусственная переменная ограничению с правой частью b (по тем же правилам, что в конструкторе)
+bool Simplex::NeedsArtificial(ConstraintType type, Fraqtion b) const {
+    if (type == ConstraintType::Equal)
+        return true;
+
+    if (type == ConstraintType::LessEqual)
+        return b < 0;
+
+    return b > 0;
+}
+
+// треугольный crash: вводим основные переменные в строки, которым иначе нужна искусственная
+void Simplex::CrashTriangular() {
+    vector<bool> crashed(m, false); // строки, в которые уже введена основная переменная
+    vector<pair<int, int>> columns; // столбцы, упорядоченные по количеству ненулевых элементов
+
+    for (int j = 0; j < n; j++) {
+        int count = 0;
+
+        for (int i = 0; i < m; i++)
+            if (table[i][j] != 0)
+                count++;
+
+        columns.push_back({ count, j });
+    }
+
+    sort(columns.begin(), columns.end());
+
+    for (int t = 0; t < n; t++) {
+        int column = columns[t].second;
+
+        if (IsBasis(column))
+            continue;
+
+        int row = -1;
+
+        for (int i = 0; i < m; i++) {
+            if (crashed[i] || basis[i] < n || !NeedsArtificial(i) || table[i][column] == 0)
+                continue;
+
+            if (row == -1 || fabs(table[i][column]) > fabs(table[row][column]))
+                row = i;
+        }
+
+        // если подходящей строки нет, то столбец пропускаем
+        if (row == -1)
+            continue;
+
+        Gauss(row, column);
+        crashed[row] = true;
+    }
+}
+
+// ввод в базис заданных столбцов (в порядке приоритета)
+void Simplex::CrashBasis(const vector<int> &columns) {
+    vector<bool> fixed(m, false); // строки, базис которых уже взят из заданного
+
+    for (int t = 0; t < columns.size(); t++) {
+        int column = columns[t];
+
+        if (column < 0 || column >= n + m)
+            continue;
+
+        int row = -1;
+
+        for (int i = 0; i < m; i++) {
+            if (basis[i] == column)
+                row = i;
+        }
+
+        // переменная уже в базисе, закрепляем её строку
+        if (row != -1) {
+            fixed[row] = true;
+            continue;
+        }
+
+        for (int i = 0; i < m; i++) {
+            if (fixed[i] || table[i][column] == 0)
+                continue;
+
+            if (row == -1 || fabs(table[i][column]) > fabs(table[row][column]))
+                row = i;
+        }
+
+        // столбец линейно зависим от уже введённых, пропускаем
+        if (row == -1)
+            continue;
+
+        Gauss(row, column);
+        fixed[row] = true;
+    }
+}
+
+// задача для метода внутренней точки по текущей таблице (min, Ax = b, x >= 0)
+InteriorPoint Simplex::BuildInteriorPoint() const {
+    vector<vector<double>> a(m, vector<double>(n + m));
+    vector<double> b(m), cost(n + m);
+
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n + m; j++)
+            a[i][j] = table[i][j].ToDouble();
+
+        b[i] = table[i][n + m].ToDouble();
+    }
+
+    for (int j = 0; j < n + m; j++)
+        cost[j] = (mode == SimplexMode::Max ? -1.0 : 1.0) * c[j].ToDouble();
+
+    return InteriorPoint(a, b, cost);
+}
+
+// crossover: вводим в базис столбцы, которые в решении метода внутренней точки строго положительны
+bool Simplex::CrashInteriorPoint(bool debug) {
+    InteriorPoint ipm = BuildInteriorPoint();
+
+    // если метод не сошёлся, то начинаем с базиса из балансовых переменных
+    if (!ipm.Solve(100, 1e-9, debug))
+        return false;
+
+    const vector<double> &x = ipm.GetX();
+    const vector<double> &z = ipm.GetS();
+    vector<pair<double, int>> candidates;
+
+    for (int j = 0; j < n + m; j++)
+        if (x[j] > z[j])
+            candidates.push_back({ -x[j] / z[j], j });
+
+    sort(candidates.begin(), candidates.end());
+
+    vector<int> columns;
+
+    for (int i = 0; i < candidates.size(); i++)
+        columns.push_back(candidates[i].second);
+
+    CrashBasis(columns); // оставшиеся отклонения исправят первая фаза и симплекс-итерации
+    return true;
+}
+
+// приближение вещественного числа дробью (цепные дроби, знаменатель не больше 10000)
+Fraqtion Simplex::ToFraqtion(double value) const {
+    int sign = value < 0 ? -1 : 1;
+    double rest = fabs(value);
+
+    long long p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+
+    for (int i = 0; i < 20; i++) {
+        long long a = (long long) floor(rest);
+        long long p2 = a * p1 + p0;
+        long long q2 = a * q1 + q0;
+
+        if (q2 > 10000 || p2 > 1000000000)
+            break;
+
+        p0 = p1; q0 = q1;
+        p1 = p2; q1 = q2;
+
+        if (rest - a < 1e-9)
+            break;
+
+        rest = 1 / (rest - a);
+    }
+
+    return Fraqtion(sign * (int) p1, (int) q1);
+}
+
+// решение методом внутренней точки без crossover (приближённое решение в дробях);
+// если метод не сошёлся за отведённые итерации (в том числе на несовместной или неограниченной
+// задаче, которые он не различает), то состояние IterationLimit, функция 0 и значений переменных нет
+SimplexSolve Simplex::SolveInteriorPoint(bool debug) {
+    InteriorPoint ipm = BuildInteriorPoint();
+    bool converged = ipm.Solve(100, 1e-9, debug);
+
+    iterations = ipm.GetIterations();
+    solved = false; // таблица не менялась
+    verifiedBasis.clear();
+    status = converged ? SolveStatus::Optimal : SolveStatus::IterationLimit;
+
+    SimplexSolve solve;
+    solve.f = 0;
+
+    if (!converged) {
+        if (debug)
+            PrintStatus();
+
+        return solve;
+    }
+
+    solve.x = vector<Fraqtion>(n + m, 0);
+
+    // функция считается по вещественной точке: сумма приближённых дробей с разными знаменателями переполняет int
+    double f = 0;
+
+    for (int j = 0; j < n + m; j++) {
+        solve.x[j] = ToFraqtion(ipm.GetX()[j]);
+        f += c[j].ToDouble() * ipm.GetX()[j];
+    }
+
+    solve.f = ToFraqtion(f);
+
+    if (debug)
+        PrintSolve(solve);
+
+    return solve;
+}
+
+// исключение Гаусса в вещественной таблице
+void Simplex::GaussDouble(vector<vector<double>> &t, vector<int> &db, int row, int column) const {
+    double pivot = t[row][column];
+
+    for (int j = 0; j < t[row].size(); j++)
+        t[row][j] /= pivot;
+
+    for (int i = 0; i < t.size(); i++) {
+        if (i == row || t[i][column] == 0)
+            continue;
+
+        double value = t[i][column];
+
+        for (int j = 0; j < t[i].size(); j++)
+            t[i][j] -= t[row][j] * value;
+    }
+
+    db[row] = column;
+}
+
+// симплекс-итерации в вещественной таблице: минимизация cost, вводятся только первые columns столбцов
+bool Simplex::OptimizeDouble(vector<vector<double>> &t, vector<int> &db, const vector<double> &cost, int columns) const {
+    const double eps = 1e-9;
+    int last = t[0].size() - 1; // столбец свободных членов
+
+    // ограничение на число итераций защищает от зацикливания, точная проверка исправит базис
+    for (int iteration = 0; iteration < 50 * (columns + 1); iteration++) {
+        int column = -1;
+        double best = -eps;
+
+        for (int j = 0; j < columns; j++) {
+            double delta = cost[j];
+
+            for (int i = 0; i < t.size(); i++)
+                delta -= cost[db[i]] * t[i][j];
+
+            if (delta < best) {
+                best = delta;
+                column = j;
+            }
+        }
+
+        // все оценки неотрицательны, план оптимален
+        if (column == -1)
+            return true;
+
+        int row = -1;
+
+        for (int i = 0; i < t.size(); i++)
+            if (t[i][column] > eps && (row == -1 || t[i][last] / t[i][column] < t[row][last] / t[row][column]))
+                row = i;
+
+        // функция не ограничена
+        if (row == -1)
+            return false;
+
+        GaussDouble(t, db, row, column);
+    }
+
+    return true;
+}
+
+// поиск оптимального базиса в вещественной арифметике (пустой вектор, если решения нет)
+vector<int> Simplex::SolveDoubleBasis() const {
+    const double eps = 1e-9;
+    vector<vector<double>> t(m, vector<double>(n + m + 1));
+    vector<int> db = basis;
+    vector<int> rows; // строки, которым нужна искусственная переменная
+
+    for (int i = 0; i < m; i++) {
+        double sign = table[i][n + m] < 0 ? -1 : 1;
+
+        for (int j = 0; j < n + m + 1; j++)
+            t[i][j] = sign * table[i][j].ToDouble();
+
+        if (fabs(t[i][db[i]] - 1) > eps)
+            rows.push_back(i);
+    }
+
+    int artificial = rows.size();
+
+    for (int i = 0; i < m; i++)
+        t[i].insert(t[i].begin() + n + m, artificial, 0);
+
+    for (int r = 0; r < artificial; r++) {
+        t[rows[r]][n + m + r] = 1;
+        db[rows[r]] = n + m + r;
+    }
+
+    // первая фаза: минимум суммы искусственных переменных
+    vector<double> cost(n + m + artificial, 0);
+
+    for (int r = 0; r < artificial; r++)
+        cost[n + m + r] = 1;
+
+    OptimizeDouble(t, db, cost, n + m + artificial);
+
+    for (int i = 0; i < m; i++)
+        if (db[i] >= n + m && t[i][n + m + artificial] > eps)
+            return {};
+
+    // вторая фаза: исходная функция, искусственные переменные в базис не вводятся
+    for (int j = 0; j < n + m + artificial; j++)
+        cost[j] = j < n + m ? (mode == SimplexMode::Max ? -1.0 : 1.0) * c[j].ToDouble() : 0;
+
+    if (!OptimizeDouble(t, db, cost, n + m))
+        return {};
+
+    return db; // номера искусственных переменных пропустит точная рефакторизация
+}
+
+// точная проверка базиса без перестройки таблицы: матрица базиса B (столбцы columns текущей таблицы)
+// раскладывается в дробях как P·B = L·U, из B x_B = b берётся план и проверяется его допустимость,
+// из Bᵀy = c_B - двойственные оценки, по которым оценка каждого небазисного столбца c_j - y·a_j
+// проверяется на оптимальность; false, если базис вырожден, план недопустим, не оптимален или дроби переполнились
+bool Simplex::CertifyBasis(const vector<int> &columns, SimplexSolve &solve) const {
+    if (columns.size() != m)
+        return false;
+
+    vector<bool> inBasis(n + m, false);
+
+    for (int k = 0; k < m; k++) {
+        if (columns[k] < 0 || columns[k] >= n + m || inBasis[columns[k]])
+            return false;
+
+        inBasis[columns[k]] = true;
+    }
+
+    Fraqtion::overflow = false;
+
+    vector<vector<Fraqtion>> lu(m, vector<Fraqtion>(m));
+    vector<int> perm(m);
+
+    for (int i = 0; i < m; i++) {
+        perm[i] = i;
+
+        for (int k = 0; k < m; k++)
+            lu[i][k] = table[i][columns[k]];
+    }
+
+    // исключение Гаусса по столбцам базиса: под диагональю остаются множители L
+    for (int k = 0; k < m; k++) {
+        int row = k;
+
+        while (row < m && lu[row][k] == 0)
+            row++;
+
+        if (row == m)
+            return false;
+
+        swap(lu[row], lu[k]);
+        swap(perm[row], perm[k]);
+
+        for (int i = k + 1; i < m; i++) {
+            if (lu[i][k] == 0)
+                continue;
+
+            lu[i][k] /= lu[k][k];
+
+            for (int j = k + 1; j < m; j++)
+                if (lu[k][j] != 0)
+                    lu[i][j] -= lu[i][k] * lu[k][j];
+        }
+    }
+
+    // B x_B = b: L z = P b, затем U x_B = z
+    vector<Fraqtion> x(m);
+
+    for (int i = 0; i < m; i++) {
+        x[i] = table[perm[i]][n + m];
+
+        for (int k = 0; k < i; k++)
+            if (lu[i][k] != 0)
+                x[i] -= lu[i][k] * x[k];
+    }
+
+    for (int i = m - 1; i >= 0; i--) {
+        for (int k = i + 1; k < m; k++)
+            if (lu[i][k] != 0)
+                x[i] -= lu[i][k] * x[k];
+
+        x[i] /= lu[i][i];
+
+        if (x[i] < 0)
+            return false;
+    }
+
+    // Bᵀy = c_B: Uᵀz = c_B, затем Lᵀv = z и y[perm[i]] = v[i]
+    vector<Fraqtion> v(m);
+
+    for (int i = 0; i < m; i++) {
+        v[i] = c[columns[i]];
+
+        for (int k = 0; k < i; k++)
+            if (lu[k][i] != 0)
+                v[i] -= lu[k][i] * v[k];
+
+        v[i] /= lu[i][i];
+    }
+
+    for (int i = m - 1; i >= 0; i--)
+        for (int k = i + 1; k < m; k++)
+            if (lu[k][i] != 0)
+                v[i] -= lu[k][i] * v[k];
+
+    vector<Fraqtion> y(m);
+
+    for (int i = 0; i < m; i++)
+        y[perm[i]] = v[i];
+
+    // оценки небазисных столбцов: на max ни одна не положительна, на min ни одна не отрицательна
+    for (int j = 0; j < n + m; j++) {
+        if (inBasis[j])
+            continue;
+
+        Fraqtion reduced = c[j];
+
+        for (int i = 0; i < m; i++)
+            if (y[i] != 0 && table[i][j] != 0)
+                reduced -= y[i] * table[i][j];
+
+        if ((mode == SimplexMode::Max && reduced > 0) || (mode == SimplexMode::Min && reduced < 0))
+            return false;
+    }
+
+    solve = SimplexSolve();
+    solve.x = vector<Fraqtion>(n + m, 0);
+    solve.f = 0;
+
+    for (int k = 0; k < m; k++) {
+        solve.x[columns[k]] = x[k];
+        solve.f += c[columns[k]] * x[k];
+    }
+
+    return !Fraqtion::overflow;
+}
+
+// решение в double с точной проверкой: базис из вещественного решения проверяется в дробях по LU-разложению
+// его матрицы (таблица не перестраивается, ответ возвращается и доступен через GetSolve и GetBasis);
+// если проверка не прошла, точные итерации начинаются с этого базиса; если решения нет, то функция 0
+// без переменных, а причина (несовместность, неограниченность, лимит, переполнение) - в GetStatus
+SimplexSolve Simplex::SolveVerified(bool debug) {
+    iterations = 0;
+    solved = false;
+    status = SolveStatus::Optimal; // меняется, если решение не найдено
+    solveStart = chrono::steady_clock::now();
+    verifiedBasis.clear();
+
+    vector<int> found = SolveDoubleBasis();
+    SimplexSolve solve;
+
+    if (CertifyBasis(found, solve)) {
+        verifiedBasis = found;
+        verifiedSolve = solve;
+        verifiedSolve.certified = true;
+
+        if (debug) {
+            PrintSolve(verifiedSolve);
+            cout << string(padding, ' ') << "Certified: yes, exact pivots: 0" << endl;
+        }
+
+        return verifiedSolve;
+    }
+
+    if (debug)
+        cout << string(padding, ' ') << "Double basis is not optimal, continue with exact pivots" << endl;
+
+    // точные итерации с базиса вещественного решения (базис пользователя при этом не меняется)
+    vector<int> savedStartBasis = startBasis;
+    SetStartBasis(found);
+    bool result = Solve(debug, CrashMode::User);
+    SetStartBasis(savedStartBasis);
+
+    // причина (несовместность, неограниченность, лимит, переполнение) остаётся в GetStatus
+    if (!result) {
+        solve = SimplexSolve();
+        solve.f = 0;
+        return solve;
+    }
+
+    solve = GetSolve();
+    solve.exactPivots = iterations;
+
+    if (debug)
+        cout << string(padding, ' ') << "Certified: no, exact pivots: " << iterations << endl;
+
+    return solve;
+}
+
+// первая фаза: поиск допустимого базиса с помощью искусственных переменных
+bool Simplex::PhaseOne(bool debug) {
+    vector<int> rows; // строки, которым нужна искусственная переменная
+
+    NormalizeRows();
+
+    // если столбец базисной переменной не единичный, то нужна искусственная
+    for (int i = 0; i < m; i++)
+        if (NeedsArtificial(i))
+            rows.push_back(i);
+
+    // начальный базис уже допустим
+    if (rows.empty())
+        return true;
+
+    // при неудаче первой фазы в базисе остаются искусственные переменные - возвращаемся к этой таблице
+    vector<vector<Fraqtion>> savedTable = table;
+    vector<int> savedBasis = basis;
+
+    k = rows.size();
+
+    for (int i = 0; i < m; i++)
+        table[i].insert(table[i].begin() + n + m, k, 0); // добавляем столбцы перед свободным членом
+
+    for (int i = 0; i < k; i++) {
+        table[rows[i]][n + m + i] = 1;
+        basis[rows[i]] = n + m + i;
+    }
+
+    // целевая функция первой фазы: минимум суммы искусственных переменных
+    vector<Fraqtion> savedC = c;
+    SimplexMode savedMode = mode;
+
+    c = vector<Fraqtion>(n + m + k + 1, 0);
+    deltas = vector<Fraqtion>(n + m + k + 1, 0);
+    mode = SimplexMode::Min;
+
+    for (int i = 0; i < k; i++)
+        c[n + m + i] = 1;
+
+    if (debug)
+        cout << string(padding, ' ') << "Phase I (artificial variables: " << k << ")" << endl;
+
+    Optimize(debug); // функция первой фазы ограничена снизу нулём
+    Fraqtion w = deltas[n + m + k]; // значение функции первой фазы
+
+    c = savedC;
+    mode = savedMode;
+
+    // первая фаза прервана лимитом или отменой либо сумму искусственных переменных не удалось обнулить
+    // (тогда решения нет): таблица и базис возвращаются к началу первой фазы, чтобы GetSolve,
+    // SaveBasis и повторное решение не видели номеров удалённых искусственных столбцов
+    if (status != SolveStatus::Optimal || w != 0) {
+        if (status == SolveStatus::Optimal) {
+            if (debug)
+                cout << string(padding, ' ') << "Phase I objective: " << w << endl;
+
+            status = SolveStatus::Infeasible;
+        }
+
+        table = savedTable;
+        basis = savedBasis;
+        deltas = vector<Fraqtion>(n + m + 1, 0);
+        k = 0;
+        return false;
+    }
+
+    // выводим из базиса оставшиеся нулевые искусственные переменные
+    for (int i = 0; i < m; i++) {
+        if (basis[i] < n + m)
+            continue;
+
+        int column = -1;
+
+        for (int j = 0; j < n + m && column == -1; j++)
+            if (table[i][j] != 0)
+                column = j;
+
+        if (column != -1) {
+            Gauss(i, column);
+            continue;
+        }
+
+        // строка линейно зависима: ставим в базис пустой столбец ограничения-равенства
+        for (int j = n; j < n + m && column == -1; j++) {
+            bool isEmpty = !IsBasis(j);
+
+            for (int r = 0; r < m && isEmpty; r++)
+                isEmpty = table[r][j] == 0;
+
+            if (isEmpty)
+                column = j;
+        }
+
+        table[i][column] = 1;
+        basis[i] = column;
+        fractionFreeDenominator = 0; // таблица изменена не шагом Гаусса - цепочку ведущих элементов не продолжить
+    }
+
+    RemoveArtificial();
+    return true;
+}
+
+// решение задачи
+bool Simplex::Solve(bool debug, CrashMode crash, bool fractionFree) {
+    iterations = 0;
+    solved = false;
+    status = SolveStatus::Optimal; // меняется, если решение не найдено
+    solveStart = chrono::steady_clock::now();
+    this->fractionFree = fractionFree;
+    this->fractionFreeDenominator = 0; // цепочка ведущих элементов начинается заново с каждым решением
+    this->verifiedBasis.clear(); // ответ снова в таблице
+    Fraqtion::overflow = false; // переполнение отслеживается с начала решения
+
+    if (crash == CrashMode::Triangular)
+        CrashTriangular();
+    else if (crash == CrashMode::User)
+        CrashBasis(startBasis);
+    else if (crash == CrashMode::InteriorPoint)
+        CrashInteriorPoint(debug);
+
+    bool feasible = PhaseOne(debug);
+
+    // после переполнения вывод о несовместности недостоверен (последний шаг цикл итераций не проверяет)
+    if (Fraqtion::overflow)
+        status = SolveStatus::Overflow;
+
+    if (!feasible || status == SolveStatus::Overflow) {
+        if (debug)
+            PrintStatus();
+
+        return false;
+    }
+
+    if (debug) {
+        cout << string(padding, ' ') << "Initial table:" << endl;
+        CalculateDeltas(); // расчитываем дельты
+        PrintTable();
+    }
+
+    // если нет разрешающей строки, то решения нет (иначе решение прервано лимитом)
+    if (!Optimize(debug) || Fraqtion::overflow) {
+        if (Fraqtion::overflow)
+            status = SolveStatus::Overflow;
+        else if (status == SolveStatus::Optimal)
+            status = SolveStatus::Unbounded;
+
+        if (debug)
+            PrintStatus();
+
+        return false;
+    }
+
+    if (debug)
+        PrintSolve(GetSolve());
+
+    solved = true;
+    return true; // решение есть
+}
+
+// задание начального базиса
+void Simplex::SetStartBasis(const vector<int> &basis) {
+    startBasis = basis;
+}
+
+// загрузка начального базиса из файла
+bool Simplex::LoadBasis(const string &path) {
+    ifstream fin(path);
+
+    if (!fin)
+        return false;
+
+    vector<int> loaded;
+    int index;
+
+    while (fin >> index)
+        loaded.push_back(index);
+
+    SetStartBasis(loaded);
+    return true;
+}
+
+// сохранение текущего базиса в файл
+bool Simplex::SaveBasis(const string &path) const {
+    ofstream fout(path);
+
+    if (!fout)
+        return false;
+
+    vector<int> current = GetBasis();
+
+    for (int i = 0; i < m; i++)
+        fout << current[i] << (i + 1 < m ? " " : "\n");
+
+    return true;
+}
+
+// количество итераций последнего решения
+int Simplex::GetIterations() const {
+    return iterations;
+}
+
+// лимиты решения и флаг отмены (0 - без лимита)
+void Simplex::SetLimits(int iterationLimit, double timeLimit, const atomic<bool> *cancel) {
+    this->iterationLimit = iterationLimit;
+    this->timeLimit = timeLimit;
+    this->cancel = cancel;
+}
+
+// состояние последнего решения
+SolveStatus Simplex::GetStatus() const {
+    return status;
+}
+
+// текущий базис
+vector<int> Simplex::GetBasis() const {
+    return verifiedBasis.empty() ? basis : verifiedBasis;
+}
+
+// исчерпан ли лимит итераций или времени, отменено ли решение, переполнились ли дроби
+bool Simplex::LimitReached() {
+    if (Fraqtion::overflow)
+        status = SolveStatus::Overflow;
+    else if (cancel && *cancel)
+        status = SolveStatus::Cancelled;
+    else if (iterationLimit > 0 && iterations >= iterationLimit)
+        status = SolveStatus::IterationLimit;
+    else if (timeLimit > 0 && chrono::duration<double>(chrono::steady_clock::now() - solveStart).count() >= timeLimit)
+        status = SolveStatus::TimeLimit;
+    else
+        return false;
+
+    return true;
+}
+
+// вывод причины, по которой решение не найдено
+void Simplex::PrintStatus() const {
+    cout << string(padding, ' ');
+
+    if (status == SolveStatus::Infeasible)
+        cout << "Solve does not exist (infeasible constraints)";
+    else if (status == SolveStatus::Unbounded)
+        cout << "Solve does not exist (unbounded function)";
+    else if (status == SolveStatus::IterationLimit)
+        cout << "Solve stopped by iteration limit";
+    else if (status == SolveStatus::TimeLimit)
+        cout << "Solve stopped by time limit";
+    else if (status == SolveStatus::Cancelled)
+        cout << "Solve cancelled";
+    else if (status == SolveStatus::Overflow)
+        cout << "Solve stopped by fraction overflow";
+
+    cout << endl << endl;
+}
+
+// запись целых чисел в снимок
+void Simplex::WriteInts(ostream &os, const vector<int> &v) const {
+    for (int i = 0; i < v.size(); i++) {
+        int32_t value = v[i];
+        os.write((const char *) &value, sizeof(value));
+    }
+}
+
+// запись дробей в снимок (числитель и знаменатель)
+void Simplex::WriteFraqtions(ostream &os, const vector<Fraqtion> &v) const {
+    for (int i = 0; i < v.size(); i++)
+        WriteInts(os, { v[i].GetN(), v[i].GetM() });
+}
+
+// чтение целых чисел из снимка
+bool Simplex::ReadInts(istream &is, vector<int> &v, int count) const {
+    v.clear();
+
+    for (int i = 0; i < count; i++) {
+        int32_t value;
+
+        if (!is.read((char *) &value, sizeof(value)))
+            return false;
+
+        v.push_back(value);
+    }
+
+    return true;
+}
+
+// чтение дробей из снимка
+bool Simplex::ReadFraqtions(istream &is, vector<Fraqtion> &v, int count) const {
+    vector<int> values;
+
+    if (!ReadInts(is, values, count * 2))
+        return false;
+
+    v.clear();
+
+    // знаменатель записывается положительным, числитель - не INT_MIN (его нельзя сменить знаком)
+    for (int i = 0; i < count; i++) {
+        if (values[2 * i + 1] <= 0 || values[2 * i] == INT_MIN)
+            return false;
+
+        v.push_back(Fraqtion(values[2 * i], values[2 * i + 1]));
+    }
+
+    return true;
+}
+
+// чтение базиса снимка: номера столбцов в [0, columns) без повторов
+bool Simplex::ReadBasis(istream &is, vector<int> &v, int count, int columns) const {
+    if (!ReadInts(is, v, count))
+        return false;
+
+    vector<bool> used(columns, false);
+
+    for (int i = 0; i < count; i++) {
+        if (v[i] < 0 || v[i] >= columns || used[v[i]])
+            return false;
+
+        used[v[i]] = true;
+    }
+
+    return true;
+}
+
+// чтение типов ограничений снимка
+bool Simplex::ReadTypes(istream &is, vector<ConstraintType> &v, int count) const {
+    vector<int> values;
+
+    if (!ReadInts(is, values, count))
+        return false;
+
+    v.clear();
+
+    for (int i = 0; i < count; i++) {
+        if (values[i] < (int) ConstraintType::LessEqual || values[i] > (int) ConstraintType::Equal)
+            return false;
+
+        v.push_back((ConstraintType) values[i]);
+    }
+
+    return true;
+}
+
+// запись вещественных чисел в снимок
+void Simplex::WriteDoubles(ostream &os, const vector<double> &v) const {
+    for (int i = 0; i < v.size(); i++)
+        os.write((const char *) &v[i], sizeof(v[i]));
+}
+
+// запись строки в снимок: длина и символы
+void Simplex::WriteString(ostream &os, const string &s) const {
+    WriteInts(os, { (int) s.size() });
+    os.write(s.data(), s.size());
+}
+
+// чтение вещественных чисел из снимка (в снимке только суммы и времена - конечные и неотрицательные)
+bool Simplex::ReadDoubles(istream &is, vector<double> &v, int count) const {
+    v.clear();
+
+    for (int i = 0; i < count; i++) {
+        double value;
+
+        if (!is.read((char *) &value, sizeof(value)) || !isfinite(value) || value < 0)
+            return false;
+
+        v.push_back(value);
+    }
+
+    return true;
+}
+
+// чтение строки из снимка
+bool Simplex::ReadString(istream &is, string &s) const {
+    int length;
+
+    if (!ReadCount(is, length, SNAPSHOT_SIZE_LIMIT))
+        return false;
+
+    s = string(length, ' ');
+    return length == 0 || (bool) is.read(&s[0], length);
+}
+
+// чтение количества элементов из [0, limit]
+bool Simplex::ReadCount(istream &is, int &count, int limit) const {
+    return ReadRange(is, count, 0, limit);
+}
+
+// чтение числа из [low, high]
+bool Simplex::ReadRange(istream &is, int &value, int low, int high) const {
+    vector<int> values;
+
+    if (!ReadInts(is, values, 1) || values[0] < low || values[0] > high)
+        return false;
+
+    value = values[0];
+    return true;
+}
+
+// запись элемента стека обхода: вид, глубина, родитель, путь, ограничения и данные обновления псевдостоимостей
+void Simplex::WriteNode(ostream &os, const BranchingNode &node) const {
+    WriteInts(os, { node.update, node.depth, node.parent });
+    WriteString(os, node.path);
+    WriteInts(os, { (int) node.rows.size() });
+
+    for (int i = 0; i < node.rows.size(); i++) {
+        WriteFraqtions(os, node.rows[i].a);
+        WriteFraqtions(os, { node.rows[i].b });
+        WriteInts(os, { (int) node.rows[i].type });
+    }
+
+    WriteInts(os, { node.index });
+    WriteFraqtions(os, { node.fraction, node.f });
+    WriteInts(os, { node.downSolved, node.upSolved });
+    WriteFraqtions(os, { node.downF, node.upF });
+}
+
+// запись найденного решения
+void Simplex::WriteSolve(ostream &os, const SimplexSolve &solve) const {
+    WriteInts(os, { (int) solve.x.size() });
+    WriteFraqtions(os, solve.x);
+    WriteFraqtions(os, { solve.f });
+    WriteInts(os, { solve.certified, solve.exactPivots });
+}
+
+// чтение ограничения узла
+bool Simplex::ReadRow(istream &is, BranchRow &row, int columns) const {
+    vector<Fraqtion> b;
+    vector<ConstraintType> type;
+
+    if (!ReadFraqtions(is, row.a, columns) || !ReadFraqtions(is, b, 1) || !ReadTypes(is, type, 1))
+        return false;
+
+    row.b = b[0];
+    row.type = type[0];
+    return true;
+}
+
+// чтение элемента стека обхода (связи между элементами проверяет LoadBranching)
+bool Simplex::ReadNode(istream &is, BranchingNode &node, int columns) const {
+    int update, count, downSolved, upSolved;
+    vector<Fraqtion> values, children;
+
+    if (!ReadRange(is, update, 0, 1) || !ReadRange(is, node.depth, 0, INT_MAX) || !ReadRange(is, node.parent, -1, INT_MAX))
+        return false;
+
+    if (!ReadString(is, node.path) || node.path.find_first_not_of("01") != string::npos || !ReadCount(is, count, SNAPSHOT_SIZE_LIMIT))
+        return false;
+
+    node.rows.clear();
+
+    for (int i = 0; i < count; i++) {
+        BranchRow row;
+
+        if (!ReadRow(is, row, columns))
+            return false;
+
+        node.rows.push_back(row);
+    }
+
+    if (!ReadRange(is, node.index, -1, columns - 1) || !ReadFraqtions(is, values, 2))
+        return false;
+
+    if (!ReadRange(is, downSolved, 0, 1) || !ReadRange(is, upSolved, 0, 1) || !ReadFraqtions(is, children, 2))
+        return false;
+
+    node.update = update;
+    node.fraction = values[0];
+    node.f = values[1];
+    node.downSolved = downSolved;
+    node.upSolved = upSolved;
+    node.downF = children[0];
+    node.upF = children[1];
+
+    // обновление делит на дробную часть и её дополнение до единицы
+    return !node.update || (node.index >= 0 && node.fraction > 0 && node.fraction < 1);
+}
+
+// чтение найденного решения: значения основных и балансовых переменных узла, функция и признаки проверки
+bool Simplex::ReadSolve(istream &is, SimplexSolve &solve, int limit) const {
+    int count, certified;
+    vector<Fraqtion> f;
+
+    if (!ReadCount(is, count, limit) || !ReadFraqtions(is, solve.x, count) || !ReadFraqtions(is, f, 1))
+        return false;
+
+    if (!ReadRange(is, certified, 0, 1) || !ReadRange(is, solve.exactPivots, 0, INT_MAX))
+        return false;
+
+    solve.f = f[0];
+    solve.certified = certified;
+    return true;
+}
+
+// чтение заголовка снимка: n, m, режим, количество начальных ограничений
+bool Simplex::ReadHeader(istream &is, vector<int> &sizes) const {
+    char magic[4];
+
+    if (!is.read(magic, 4) || !equal(magic, magic + 4, SNAPSHOT_MAGIC))
+        return false;
+
+    vector<int> version;
+
+    if (!ReadInts(is, version, 1) || version[0] != SNAPSHOT_VERSION)
+        return false;
+
+    if (!ReadInts(is, sizes, 4))
+        return false;
+
+    // размеры ограничены, чтобы испорченный файл не заставил выделить огромные таблицы
+    if (sizes[0] <= 0 || sizes[0] > SNAPSHOT_SIZE_LIMIT || sizes[1] <= 0 || sizes[1] > SNAPSHOT_SIZE_LIMIT || sizes[3] < 0 || sizes[3] > SNAPSHOT_SIZE_LIMIT)
+        return false;
+
+    if (sizes[2] != 0 && sizes[2] != 1)
+        return false;
+
+    long long cells = (long long) sizes[1] * (sizes[0] + sizes[1] + 1) + (long long) sizes[3] * (sizes[0] + 1);
+    return cells <= SNAPSHOT_CELL_LIMIT;
+}
+
+// сохранение состояния в бинарный снимок
+// формат: сигнатура, версия, n, m, режим, число начальных ограничений, затем плоские массивы
+// int32 (дробь - пара числитель/знаменатель), поэтому файл можно отображать в память;
+// снимок пишется во временный файл и переименовывается, так что прежний снимок не портится при сбое
+bool Simplex::SaveSnapshot(const string &path) const {
+    string temporary = path + ".tmp";
+    ofstream fout(temporary, ios::binary);
+
+    if (!fout)
+        return false;
+
+    fout.write(SNAPSHOT_MAGIC, 4);
+    WriteInts(fout, { SNAPSHOT_VERSION, n, m, mode == SimplexMode::Max ? 0 : 1, (int) initialA.size() });
+
+    WriteInts(fout, basis);
+
+    for (int i = 0; i < m; i++)
+        WriteFraqtions(fout, table[i]);
+
+    WriteFraqtions(fout, c);
+    WriteFraqtions(fout, deltas);
+
+    for (int i = 0; i < m; i++)
+        WriteInts(fout, { (int) types[i] });
+
+    for (int i = 0; i < initialA.size(); i++) {
+        WriteFraqtions(fout, initialA[i]);
+        WriteInts(fout, { (int) initialTypes[i] });
+    }
+
+    WriteFraqtions(fout, initialB);
+    WriteFraqtions(fout, initialC);
+    fout.close();
+
+    if (!fout || rename(temporary.c_str(), path.c_str()) != 0) {
+        remove(temporary.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// восстановление состояния из снимка
+bool Simplex::LoadSnapshot(const string &path) {
+    ifstream fin(path, ios::binary);
+    vector<int> sizes;
+
+    if (!fin || !ReadHeader(fin, sizes))
+        return false;
+
+    int sn = sizes[0];
+    int sm = sizes[1];
+    int rows = sizes[3];
+
+    vector<int> sbasis;
+    vector<vector<Fraqtion>> stable(sm);
+    vector<Fraqtion> sc, sdeltas;
+    vector<ConstraintType> stypes;
+
+    if (!ReadBasis(fin, sbasis, sm, sn + sm))
+        return false;
+
+    for (int i = 0; i < sm; i++)
+        if (!ReadFraqtions(fin, stable[i], sn + sm + 1))
+            return false;
+
+    if (!ReadFraqtions(fin, sc, sn + sm + 1) || !ReadFraqtions(fin, sdeltas, sn + sm + 1) || !ReadTypes(fin, stypes, sm))
+        return false;
+
+    vector<vector<Fraqtion>> sa(rows);
+    vector<ConstraintType> sinitialTypes;
+    vector<Fraqtion> sb, sinitialC;
+
+    for (int i = 0; i < rows; i++) {
+        vector<ConstraintType> type;
+
+        if (!ReadFraqtions(fin, sa[i], sn) || !ReadTypes(fin, type, 1))
+            return false;
+
+        sinitialTypes.push_back(type[0]);
+    }
+
+    if (!ReadFraqtions(fin, sb, rows) || !ReadFraqtions(fin, sinitialC, sn))
+        return false;
+
+    // снимок прочитан полностью, заменяем состояние
+    n = sn;
+    m = sm;
+    k = 0;
+    mode = sizes[2] == 0 ? SimplexMode::Max : SimplexMode::Min;
+    basis = sbasis;
+    table = stable;
+    c = sc;
+    deltas = sdeltas;
+    types = stypes;
+    initialA = sa;
+    initialB = sb;
+    initialC = sinitialC;
+    initialTypes = sinitialTypes;
+    verifiedBasis.clear();
+
+    return true;
+}
+
+// загрузка только базиса из снимка (тёплый старт для изменённой модели)
+bool Simplex::LoadSnapshotBasis(const string &path) {
+    ifstream fin(path, ios::binary);
+    vector<int> sizes;
+    vector<int> loaded;
+
+    if (!fin || !ReadHeader(fin, sizes) || !ReadBasis(fin, loaded, sizes[1], sizes[0] + sizes[1]))
+        return false;
+
+    // номера балансовых переменных сдвигаем под количество переменных текущей задачи
+    for (int i = 0; i < loaded.size(); i++)
+        if (loaded[i] >= sizes[0])
+            loaded[i] += n - sizes[0];
+
+    SetStartBasis(loaded);
+    return true;
+}
+
+// сохранение приостановленного поиска ветвей и границ: корневая задача (с отсечениями корня), настройки,
+// статистика, псевдостоимости, пул отсечений, стек обхода и найденные решения; кэш и флаг паузы не сохраняются.
+// Формат как у SaveSnapshot: сигнатура, версия, плоские массивы int32 (времена и псевдостоимости - double),
+// запись во временный файл с переименованием
+bool Simplex::SaveBranching(const string &path, const BranchingState &state) const {
+    string temporary = path + ".tmp";
+    ofstream fout(temporary, ios::binary);
+
+    if (!fout)
+        return false;
+
+    fout.write(BRANCHING_MAGIC, 4);
+    WriteInts(fout, { BRANCHING_VERSION, n, (int) initialA.size(), mode == SimplexMode::Max ? 0 : 1 });
+
+    for (int i = 0; i < initialA.size(); i++) {
+        WriteFraqtions(fout, initialA[i]);
+        WriteInts(fout, { (int) initialTypes[i] });
+    }
+
+    WriteFraqtions(fout, initialB);
+    WriteFraqtions(fout, initialC);
+
+    WriteInts(fout, { (int) state.rule, (int) state.order, state.reliability, state.strongIterations, state.strongCandidates });
+    WriteInts(fout, { state.hasIncumbent, state.nodes, state.incumbentNode, state.firstIncumbentNode, state.stoppedNodes, (int) state.stopStatus });
+    WriteInts(fout, { state.cuts, state.rootCutRounds, state.localCutRounds, state.maxCutAge, state.maxCutsPerRound, state.cutsAdded });
+    WriteInts(fout, { state.heuristics, max(state.heuristicFrequency, 0), state.maxDiveDepth, state.pumpIterations });
+    WriteFraqtions(fout, { state.incumbent });
+
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - state.start).count();
+    WriteDoubles(fout, { state.incumbentSeconds, state.firstIncumbentSeconds, elapsed });
+
+    WriteInts(fout, { (int) state.downSum.size() });
+    WriteDoubles(fout, state.downSum);
+    WriteDoubles(fout, state.upSum);
+    WriteInts(fout, state.downCount);
+    WriteInts(fout, state.upCount);
+
+    WriteInts(fout, { (int) state.incumbentX.size() });
+    WriteFraqtions(fout, state.incumbentX);
+    WriteString(fout, state.incumbentSource);
+    WriteString(fout, state.firstIncumbentSource);
+
+    const vector<Cut> &cuts = state.pool.GetCuts();
+    WriteInts(fout, { (int) cuts.size() });
+
+    for (int i = 0; i < cuts.size(); i++) {
+        WriteFraqtions(fout, cuts[i].a);
+        WriteFraqtions(fout, { cuts[i].b });
+        WriteInts(fout, { cuts[i].age });
+    }
+
+    WriteInts(fout, { (int) state.pending.size() });
+
+    for (int i = 0; i < state.pending.size(); i++)
+        WriteNode(fout, state.pending[i]);
+
+    WriteInts(fout, { (int) state.found.size() });
+
+    for (int i = 0; i < state.found.size(); i++) {
+        WriteString(fout, state.found[i].first);
+        WriteSolve(fout, state.found[i].second);
+    }
+
+    fout.close();
+
+    if (!fout || rename(temporary.c_str(), path.c_str()) != 0) {
+        remove(temporary.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// восстановление задачи и поиска ветвей и границ для продолжения вызовом SolveIntegerBranchesAndBorders(state);
+// кэш, флаг и порог паузы остаются заданными в state, лимиты и отступ - заданными в этой задаче
+bool Simplex::LoadBranching(const string &path, BranchingState &state) {
+    ifstream fin(path, ios::binary);
+    char magic[4];
+    vector<int> header;
+
+    if (!fin || !fin.read(magic, 4) || !equal(magic, magic + 4, BRANCHING_MAGIC) || !ReadInts(fin, header, 4) || header[0] != BRANCHING_VERSION)
+        return false;
+
+    int sn = header[1];
+    int rows = header[2];
+
+    // размеры ограничены, как в ReadHeader; клетки считаются по всем ограничениям и отсечениям файла
+    if (sn <= 0 || sn > SNAPSHOT_SIZE_LIMIT || rows <= 0 || rows > SNAPSHOT_SIZE_LIMIT || (header[3] != 0 && header[3] != 1))
+        return false;
+
+    long long cells = (long long) rows * (sn + 1);
+
+    if (cells > SNAPSHOT_CELL_LIMIT)
+        return false;
+
+    vector<vector<Fraqtion>> sa(rows);
+    vector<ConstraintType> sinitialTypes;
+    vector<Fraqtion> sb, sinitialC;
+
+    for (int i = 0; i < rows; i++) {
+        vector<ConstraintType> type;
+
+        if (!ReadFraqtions(fin, sa[i], sn) || !ReadTypes(fin, type, 1))
+            return false;
+
+        sinitialTypes.push_back(type[0]);
+    }
+
+    if (!ReadFraqtions(fin, sb, rows) || !ReadFraqtions(fin, sinitialC, sn))
+        return false;
+
+    BranchingState loaded = state;
+    int rule, order, hasIncumbent, stopStatus, cuts, heuristics;
+
+    if (!ReadRange(fin, rule, 0, (int) BranchingRule::Strong) || !ReadRange(fin, order, 0, (int) ChildOrder::Nearest) || !ReadRange(fin, loaded.reliability, 0, INT_MAX))
+        return false;
+
+    if (!ReadRange(fin, loaded.strongIterations, 0, INT_MAX) || !ReadRange(fin, loaded.strongCandidates, 0, INT_MAX) || !ReadRange(fin, hasIncumbent, 0, 1))
+        return false;
+
+    if (!ReadRange(fin, loaded.nodes, 0, INT_MAX) || !ReadRange(fin, loaded.incumbentNode, 0, INT_MAX) || !ReadRange(fin, loaded.firstIncumbentNode, 0, INT_MAX))
+        return false;
+
+    if (!ReadRange(fin, loaded.stoppedNodes, 0, INT_MAX) || !ReadRange(fin, stopStatus, 0, (int) SolveStatus::Overflow) || !ReadRange(fin, cuts, 0, 1))
+        return false;
+
+    if (!ReadRange(fin, loaded.rootCutRounds, 0, INT_MAX) || !ReadRange(fin, loaded.localCutRounds, 0, INT_MAX) || !ReadRange(fin, loaded.maxCutAge, 0, INT_MAX))
+        return false;
+
+    if (!ReadRange(fin, loaded.maxCutsPerRound, 0, INT_MAX) || !ReadRange(fin, loaded.cutsAdded, 0, INT_MAX) || !ReadRange(fin, heuristics, 0, 1))
+        return false;
+
+    if (!ReadRange(fin, loaded.heuristicFrequency, 0, INT_MAX) || !ReadRange(fin, loaded.maxDiveDepth, 0, INT_MAX) || !ReadRange(fin, loaded.pumpIterations, 0, INT_MAX))
+        return false;
+
+    vector<Fraqtion> incumbent;
+    vector<double> times;
+    int count;
+
+    if (!ReadFraqtions(fin, incumbent, 1) || !ReadDoubles(fin, times, 3))
+        return false;
+
+    // псевдостоимости либо ещё не заведены, либо заданы для всех переменных
+    if (!ReadCount(fin, count, sn) || (count != 0 && count != sn))
+        return false;
+
+    if (!ReadDoubles(fin, loaded.downSum, count) || !ReadDoubles(fin, loaded.upSum, count) || !ReadInts(fin, loaded.downCount, count) || !ReadInts(fin, loaded.upCount, count))
+        return false;
+
+    for (int j = 0; j < count; j++)
+        if (loaded.downCount[j] < 0 || loaded.upCount[j] < 0)
+            return false;
+
+    if (!ReadCount(fin, count, sn) || (count != 0 && count != sn) || !ReadFraqtions(fin, loaded.incumbentX, count))
+        return false;
+
+    if (!ReadString(fin, loaded.incumbentSource) || !ReadString(fin, loaded.firstIncumbentSource))
+        return false;
+
+    vector<Cut> pool;
+
+    if (!ReadCount(fin, count, SNAPSHOT_SIZE_LIMIT))
+        return false;
+
+    for (int i = 0; i < count; i++) {
+        Cut cut;
+        vector<Fraqtion> b;
+
+        cells += sn + 1;
+
+        if (cells > SNAPSHOT_CELL_LIMIT || !ReadFraqtions(fin, cut.a, sn) || !ReadFraqtions(fin, b, 1) || !ReadRange(fin, cut.age, 0, INT_MAX))
+            return false;
+
+        cut.b = b[0];
+        pool.push_back(cut);
+    }
+
+    if (!ReadCount(fin, count, SNAPSHOT_SIZE_LIMIT))
+        return false;
+
+    loaded.pending.clear();
+
+    for (int i = 0; i < count; i++) {
+        BranchingNode node;
+
+        if (!ReadNode(fin, node, sn))
+            return false;
+
+        cells += (long long) node.rows.size() * (sn + 1);
+
+        if (cells > SNAPSHOT_CELL_LIMIT)
+            return false;
+
+        // обновление пишет в псевдостоимости, дочерняя задача - в обновление родителя ниже по стеку
+        if (node.update && loaded.downSum.size() != sn)
+            return false;
+
+        if (!node.update && node.path.empty() != (node.parent == -1))
+            return false;
+
+        if (!node.update && node.parent != -1 && (node.parent >= i || !loaded.pending[node.parent].update))
+            return false;
+
+        loaded.pending.push_back(node);
+    }
+
+    if (!ReadCount(fin, count, SNAPSHOT_SIZE_LIMIT))
+        return false;
+
+    loaded.found.clear();
+
+    for (int i = 0; i < count; i++) {
+        string key;
+        SimplexSolve solve;
+
+        // ключ - путь узла из '0' и '1' с завершающей '2'
+        if (!ReadString(fin, key) || key.empty() || key.back() != '2' || key.find_first_not_of("01") != key.size() - 1)
+            return false;
+
+        // решение узла содержит и его балансовые переменные, поэтому длина ограничена только числом клеток
+        if (!ReadSolve(fin, solve, SNAPSHOT_CELL_LIMIT - cells))
+            return false;
+
+        cells += solve.x.size();
+        loaded.found.push_back({ key, solve });
+    }
+
+    // снимок прочитан полностью, заменяем задачу и поиск
+    loaded.rule = (BranchingRule) rule;
+    loaded.order = (ChildOrder) order;
+    loaded.hasIncumbent = hasIncumbent;
+    loaded.stopStatus = (SolveStatus) stopStatus;
+    loaded.cuts = cuts;
+    loaded.heuristics = heuristics;
+    loaded.incumbent = incumbent[0];
+    loaded.incumbentSeconds = times[0];
+    loaded.firstIncumbentSeconds = times[1];
+    loaded.start = chrono::steady_clock::now() - chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(times[2]));
+    loaded.pool.Restore(pool);
+
+    Simplex root(sa, sb, sinitialC, sinitialTypes, header[3] == 0 ? SimplexMode::Max : SimplexMode::Min, padding);
+    root.SetLimits(iterationLimit, timeLimit, cancel);
+
+    *this = root;
+    state = loaded;
+
+    return true;
+}
+
+// получение индекса вещественного решения
+int Simplex::GetRealIndex(const vector<Fraqtion> &x) {
+    int imax = -1;
+    for (int i = 0; i < n; i++) {
+        if (x[i].IsInteger()) // если не совпадает с целой частью
+            continue;
+
+        if (imax == -1 || x[imax].GetRealPart() < x[i].GetRealPart())
+            imax = i;
+    }
+
+    return imax; // нет такого
+}
+
+// добавление ограничения row·x <= b к текущей таблице, базисной становится его балансовая переменная
+void Simplex::AddRow(const vector<Fraqtion> &row, Fraqtion b) {
+    // сдвигаем столбец свободных членов, освобождая место под новую переменную
+    for (int i = 0; i < m; i++) {
+        table[i].push_back(table[i][n + m]);
+        table[i][n + m] = 0;
+    }
+
+    table.push_back(vector<Fraqtion>(n + m + 2, 0));
+
+    for (int i = 0; i < n + m; i++)
+        table[m][i] = row[i];
+
+    table[m][n + m] = 1;
+    table[m][n + m + 1] = b;
+
+    c.push_back(0);
+    deltas.push_back(0);
+    basis.push_back(n + m);
+    types.push_back(ConstraintType::LessEqual);
+
+    m++;
+}
+
+// добавление ограничения a·x <= b по основным переменным: базисные переменные исключаются
+// строками таблицы, а само ограничение запоминается в начальных условиях для дочерних задач
+void Simplex::AddStructuralRow(const vector<Fraqtion> &a, Fraqtion b) {
+    vector<Fraqtion> row(n + m, 0);
+    Fraqtion rhs = b;
+
+    for (int j = 0; j < n; j++)
+        row[j] = a[j];
+
+    for (int i = 0; i < m; i++) {
+        Fraqtion value = row[basis[i]];
+
+        if (value == 0)
+            continue;
+
+        for (int j = 0; j < n + m; j++)
+            row[j] -= table[i][j] * value;
+
+        rhs -= table[i][n + m] * value;
+    }
+
+    AddRow(row, rhs);
+
+    initialA.push_back(a);
+    initialB.push_back(b);
+    initialTypes.push_back(ConstraintType::LessEqual);
+}
+
+// целочисленна ли переменная: основные всегда, балансовые - если строка целочисленная
+bool Simplex::IsIntegerColumn(int column) const {
+    if (column < n)
+        return true;
+
+    int row = column - n;
+
+    if (row >= initialA.size() || !initialB[row].IsInteger())
+        return false;
+
+    for (int j = 0; j < n; j++)
+        if (!initialA[row][j].IsInteger())
+            return false;
+
+    return true;
+}
+
+// округление вниз
+Fraqtion Simplex::Floor(Fraqtion x) const {
+    return x - x.GetRealPart();
+}
+
+// нарушение отсечения в точке x (положительное, если точка отсекается)
+Fraqtion Simplex::Violation(const Cut &cut, const vector<Fraqtion> &x) const {
+    Fraqtion sum = 0;
+
+    for (int j = 0; j < n; j++)
+        sum += cut.a[j] * x[j];
+
+    return sum - cut.b;
+}
+
+// перевод отсечения alpha·x <= beta из переменных таблицы в основные переменные:
+// балансовая переменная строки a·x <= b равна b - a·x, строки a·x >= b равна a·x - b
+bool Simplex::ToStructural(const vector<Fraqtion> &alpha, Fraqtion beta, Cut &cut) const {
+    if (m != initialA.size())
+        return false;
+
+    cut.a = vector<Fraqtion>(alpha.begin(), alpha.begin() + n);
+    cut.b = beta;
+
+    for (int i = 0; i < m; i++) {
+        Fraqtion value = alpha[n + i];
+
+        if (value == 0 || initialTypes[i] == ConstraintType::Equal)
+            continue;
+
+        Fraqtion sign = initialTypes[i] == ConstraintType::LessEqual ? 1 : -1;
+
+        for (int j = 0; j < n; j++)
+            cut.a[j] -= initialA[i][j] * value * sign;
+
+        cut.b -= initialB[i] * value * sign;
+    }
+
+    return true;
+}
+
+// смешанно-целочисленное отсечение Гомори по строке таблицы: sum(gamma * x) >= 1
+// возвращается как коэффициенты alpha = -gamma ограничения alpha·x <= -1
+vector<Fraqtion> Simplex::GomoryRow(int row) const {
+    Fraqtion f0 = Part(table[row][n + m]);
+    vector<Fraqtion> alpha(n + m, 0);
+
+    for (int j = 0; j < n + m; j++) {
+        if (IsBasis(j) || table[row][j] == 0)
+            continue;
+
+        if (IsIntegerColumn(j)) {
+            Fraqtion fj = Part(table[row][j]);
+            alpha[j] = fj <= f0 ? -fj / f0 : -(Fraqtion(1) - fj) / (Fraqtion(1) - f0);
+        }
+        else {
+            alpha[j] = table[row][j] > 0 ? -table[row][j] / f0 : table[row][j] / (Fraqtion(1) - f0);
+        }
+    }
+
+    return alpha;
+}
+
+// отсечения Гомори по строкам с дробной основной базисной переменной
+void Simplex::SeparateGomory(vector<Cut> &cuts) const {
+    for (int i = 0; i < m; i++) {
+        if (basis[i] >= n || table[i][n + m].IsInteger())
+            continue;
+
+        Cut cut;
+
+        if (ToStructural(GomoryRow(i), -1, cut))
+            cuts.push_back(cut);
+    }
+}
+
+// MIR-отсечения: строка a·x <= b делится на delta из модулей коэффициентов и округляется
+void Simplex::SeparateMir(const vector<Fraqtion> &x, vector<Cut> &cuts) const {
+    for (int i = 0; i < initialA.size(); i++) {
+        for (int side = 0; side < 2; side++) {
+            // строку >= умножаем на -1, равенство даёт обе стороны
+            if (initialTypes[i] == ConstraintType::LessEqual && side == 1)
+                continue;
+
+            if (initialTypes[i] == ConstraintType::GreaterEqual && side == 0)
+                continue;
+
+            Fraqtion sign = side == 0 ? 1 : -1;
+            Cut best;
+            Fraqtion bestViolation = 0;
+
+            for (int d = 0; d < n; d++) {
+                if (initialA[i][d] == 0)
+                    continue;
+
+                Fraqtion delta = fabs(initialA[i][d]);
+                Fraqtion f0 = Part(initialB[i] * sign / delta);
+
+                if (f0 == 0)
+                    continue;
+
+                Cut cut;
+                cut.a = vector<Fraqtion>(n, 0);
+                cut.b = Floor(initialB[i] * sign / delta);
+
+                for (int j = 0; j < n; j++) {
+                    Fraqtion value = initialA[i][j] * sign / delta;
+                    Fraqtion fj = Part(value);
+
+                    cut.a[j] = Floor(value) + (fj > f0 ? (fj - f0) / (Fraqtion(1) - f0) : Fraqtion(0));
+                }
+
+                Fraqtion violation = Violation(cut, x);
+
+                if (violation > bestViolation) {
+                    bestViolation = violation;
+                    best = cut;
+                }
+            }
+
+            if (bestViolation > 0)
+                cuts.push_back(best);
+        }
+    }
+}
+
+// расширенные покрытия строк-рюкзаков a·x <= b (a >= 0): в покрытие входят только переменные
+// с 2a > b, которые из этой же строки не больше 1
+void Simplex::SeparateCover(const vector<Fraqtion> &x, vector<Cut> &cuts) const {
+    for (int i = 0; i < initialA.size(); i++) {
+        if (initialTypes[i] != ConstraintType::LessEqual || initialB[i] <= 0)
+            continue;
+
+        bool isKnapsack = true;
+
+        for (int j = 0; j < n && isKnapsack; j++)
+            isKnapsack = initialA[i][j] >= 0;
+
+        if (!isKnapsack)
+            continue;
+
+        // жадно набираем покрытие по возрастанию (1 - x) / a
+        vector<pair<double, int>> items;
+
+        for (int j = 0; j < n; j++)
+            if (initialA[i][j] * 2 > initialB[i])
+                items.push_back({ (Fraqtion(1) - x[j]).ToDouble() / initialA[i][j].ToDouble(), j });
+
+        sort(items.begin(), items.end());
+
+        vector<int> cover;
+        Fraqtion weight = 0;
+
+        for (int t = 0; t < items.size() && weight <= initialB[i]; t++) {
+            cover.push_back(items[t].second);
+            weight += initialA[i][items[t].second];
+        }
+
+        if (weight <= initialB[i])
+            continue;
+
+        // поднятие: переменные не легче самого тяжёлого элемента покрытия входят с коэффициентом 1
+        Fraqtion heaviest = 0;
+        Cut cut;
+        cut.a = vector<Fraqtion>(n, 0);
+        cut.b = (int) cover.size() - 1;
+
+        for (int t = 0; t < cover.size(); t++) {
+            cut.a[cover[t]] = 1;
+            heaviest = max(heaviest, initialA[i][cover[t]]);
+        }
+
+        for (int t = 0; t < items.size(); t++)
+            if (initialA[i][items[t].second] >= heaviest)
+                cut.a[items[t].second] = 1;
+
+        if (Violation(cut, x) > 0)
+            cuts.push_back(cut);
+    }
+}
+
+// не грозит ли таблице переполнение дробей при дальнейших отсечениях
+bool Simplex::IsTableSafe() const {
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j <= n + m; j++)
+            if (table[i][j].GetM() > TABLE_SAFE_LIMIT || abs(table[i][j].GetN()) > TABLE_SAFE_LIMIT)
+                return false;
+
+    return true;
+}
+
+// раунды отсечений в узле: новые отсечения попадают в пул, самые нарушенные отсечения пула
+// добавляются в таблицу, план восстанавливается двойственным симплекс-методом.
+// В корне отсечения глобальные, ниже они опираются на ограничения ветвления и действуют только в поддереве узла
+bool Simplex::CutRounds(BranchingState &state, int rounds, bool global) {
+    CutPool local; // отсечения, верные только в поддереве узла
+    CutPool &pool = global ? state.pool : local;
+
+    for (int round = 0; round < rounds; round++) {
+        SimplexSolve solve = GetSolve();
+        vector<Cut> found;
+
+        SeparateGomory(found);
+        SeparateMir(solve.x, found);
+        SeparateCover(solve.x, found);
+
+        for (int i = 0; i < found.size(); i++)
+            pool.Add(found[i]);
+
+        // отбираем самые нарушенные отсечения глобального и локального пулов
+        vector<Cut> candidates = state.pool.GetCuts();
+
+        if (!global)
+            candidates.insert(candidates.end(), local.GetCuts().begin(), local.GetCuts().end());
+
+        vector<pair<Fraqtion, int>> violated;
+
+        for (int i = 0; i < candidates.size(); i++) {
+            Fraqtion violation = Violation(candidates[i], solve.x);
+
+            if (violation > 0)
+                violated.push_back({ violation, i });
+        }
+
+        if (violated.empty())
+            break;
+
+        sort(violated.begin(), violated.end(), [](const pair<Fraqtion, int> &a, const pair<Fraqtion, int> &b) {
+            return a.first > b.first;
+        });
+
+        if (violated.size() > state.maxCutsPerRound)
+            violated.resize(state.maxCutsPerRound);
+
+        Simplex backup = *this; // таблица до раунда на случай роста дробей
+        Fraqtion::overflow = false;
+
+        for (int i = 0; i < violated.size(); i++)
+            AddStructuralRow(candidates[violated[i].second].a, candidates[violated[i].second].b);
+
+        bool feasible = DualIterations(10 * (n + m));
+
+        // дроби в таблице выросли слишком сильно: откатываем раунд и прекращаем отсечения
+        if (Fraqtion::overflow || !IsTableSafe()) {
+            *this = backup;
+            break;
+        }
+
+        if (!feasible) {
+            status = SolveStatus::Infeasible;
+            solved = false;
+            return false;
+        }
+
+        state.cutsAdded += violated.size();
+
+        // если двойственных итераций не хватило, то доводим план обычным решением
+        for (int i = 0; i < m; i++)
+            if (table[i][n + m] < 0)
+                return Solve(false);
+    }
+
+    state.pool.Age(GetSolve().x, state.maxCutAge);
+    return true;
+}
+
+// лучше ли значение функции текущего рекорда
+bool Simplex::IsBetter(Fraqtion f, const BranchingState &state) const {
+    if (!state.hasIncumbent)
+        return true;
+
+    return mode == SimplexMode::Max ? f > state.incumbent : f < state.incumbent;
+}
+
+// обновление рекорда с учётом времени до первого решения
+void Simplex::UpdateIncumbent(const SimplexSolve &solve, BranchingState &state, const string &source) const {
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - state.start).count();
+
+    if (!state.hasIncumbent) {
+        state.firstIncumbentNode = state.nodes;
+        state.firstIncumbentSeconds = seconds;
+        state.firstIncumbentSource = source;
+    }
+
+    state.hasIncumbent = true;
+    state.incumbent = solve.f;
+    state.incumbentX = vector<Fraqtion>(solve.x.begin(), solve.x.begin() + n);
+    state.incumbentSource = source;
+    state.incumbentNode = state.nodes;
+    state.incumbentSeconds = seconds;
+}
+
+// проверка точки, найденной эвристикой: целочисленность, ограничения узла и улучшение рекорда
+bool Simplex::TryHeuristicSolve(const vector<Fraqtion> &x, BranchingState &state, const string &source, vector<SimplexSolve> &solves) const {
+    for (int j = 0; j < n; j++)
+        if (!x[j].IsInteger() || x[j] < 0)
+            return false;
+
+    bool overflow = Fraqtion::overflow;
+    Fraqtion::overflow = false;
+
+    bool feasible = CheckSolve(x);
+
+    SimplexSolve solve;
+    solve.x = vector<Fraqtion>(x.begin(), x.begin() + n);
+    solve.f = 0;
+
+    for (int j = 0; j < n; j++)
+        solve.f += initialC[j] * x[j];
+
+    // при переполнении проверка ограничений и значение функции недостоверны - точку не берём
+    bool valid = feasible && !Fraqtion::overflow;
+    Fraqtion::overflow = overflow;
+
+    if (!valid || !IsBetter(solve.f, state))
+        return false;
+
+    UpdateIncumbent(solve, state, source);
+    solves.push_back(solve);
+
+    cout << string(padding, ' ') << "Heuristic " << source << " found F: " << solve.f << endl;
+    return true;
+}
+
+// не нарушит ли округление переменной вверх или вниз ни одной строки
+bool Simplex::CanRound(int column, bool up) const {
+    for (int i = 0; i < initialA.size(); i++) {
+        Fraqtion a = up ? initialA[i][column] : -initialA[i][column]; // изменение левой части
+
+        if (a == 0)
+            continue;
+
+        if (initialTypes[i] == ConstraintType::Equal)
+            return false;
+
+        if (initialTypes[i] == ConstraintType::LessEqual && a > 0)
+            return false;
+
+        if (initialTypes[i] == ConstraintType::GreaterEqual && a < 0)
+            return false;
+    }
+
+    return true;
+}
+
+// безопасное округление: каждая дробная переменная округляется в сторону, не нарушающую строк
+void Simplex::SimpleRounding(const SimplexSolve &solve, BranchingState &state, vector<SimplexSolve> &solves) const {
+    vector<Fraqtion> x(solve.x.begin(), solve.x.begin() + n);
+
+    for (int j = 0; j < n; j++) {
+        if (x[j].IsInteger())
+            continue;
+
+        if (CanRound(j, false))
+            x[j] = Floor(x[j]);
+        else if (CanRound(j, true))
+            x[j] = Floor(x[j]) + 1;
+        else
+            return;
+    }
+
+    TryHeuristicSolve(x, state, "simple rounding", solves);
+}
+
+// округление со сдвигами: округляем до ближайшего и исправляем нарушенные строки
+// сдвигом переменной, которая нарушает меньше всего других строк
+void Simplex::ShiftRounding(const SimplexSolve &solve, BranchingState &state, vector<SimplexSolve> &solves) const {
+    vector<Fraqtion> x(n);
+
+    for (int j = 0; j < n; j++)
+        x[j] = Floor(solve.x[j] + Fraqtion(1, 2));
+
+    for (int shift = 0; shift < 2 * (n + (int) initialA.size()); shift++) {
+        // ищем самую нарушенную строку: violation > 0 означает, что левую часть нужно уменьшить
+        int row = -1;
+        Fraqtion rowViolation = 0;
+
+        for (int i = 0; i < initialA.size(); i++) {
+            Fraqtion sum = 0;
+
+            for (int j = 0; j < n; j++)
+                sum += initialA[i][j] * x[j];
+
+            Fraqtion violation = 0;
+
+            if (initialTypes[i] != ConstraintType::GreaterEqual && sum > initialB[i])
+                violation = sum - initialB[i];
+            else if (initialTypes[i] != ConstraintType::LessEqual && sum < initialB[i])
+                violation = sum - initialB[i];
+
+            if (fabs(violation) > fabs(rowViolation)) {
+                row = i;
+                rowViolation = violation;
+            }
+        }
+
+        if (row == -1) {
+            TryHeuristicSolve(x, state, "shift rounding", solves);
+            return;
+        }
+
+        int column = -1;
+        Fraqtion columnShift = 0;
+        int columnDamage = 0;
+
+        for (int j = 0; j < n; j++) {
+            if (initialA[row][j] == 0)
+                continue;
+
+            // сдвиг переменной, полностью исправляющий строку (целый, не выводящий за x >= 0)
+            Fraqtion delta = rowViolation / initialA[row][j];
+            Fraqtion amount = delta > 0 ? -Floor(-delta) : Floor(delta);
+            Fraqtion target = x[j] - amount;
+
+            if (target < 0)
+                target = 0;
+
+            if (target == x[j])
+                continue;
+
+            // число строк, которые сдвиг делает нарушенными
+            int damage = 0;
+
+            for (int i = 0; i < initialA.size(); i++) {
+                if (i == row)
+                    continue;
+
+                Fraqtion sum = 0;
+
+                for (int t = 0; t < n; t++)
+                    sum += initialA[i][t] * (t == j ? target : x[t]);
+
+                if ((initialTypes[i] != ConstraintType::GreaterEqual && sum > initialB[i]) || (initialTypes[i] != ConstraintType::LessEqual && sum < initialB[i]))
+                    damage++;
+            }
+
+            if (column == -1 || damage < columnDamage) {
+                column = j;
+                columnShift = target;
+                columnDamage = damage;
+            }
+        }
+
+        if (column == -1)
+            return;
+
+        x[column] = columnShift;
+    }
+}
+
+// ныряние по тёплой таблице: фиксируем границу дробной переменной и досчитываем план
+// двойственным симплекс-методом. Дробное ныряние выбирает переменную, ближайшую к целой,
+// направленное округляет переменную в сторону значения в рекорде
+void Simplex::Diving(BranchingState &state, bool guided, vector<SimplexSolve> &solves) const {
+    Simplex dive = *this;
+    string source = guided && state.hasIncumbent ? "guided diving" : "fractional diving";
+    bool overflow = Fraqtion::overflow; // флаг узла, сбрасываемый на каждом шаге ныряния
+
+    for (int depth = 0; depth < state.maxDiveDepth; depth++) {
+        SimplexSolve solve = dive.GetSolve();
+
+        // ныряние не найдёт решения лучше рекорда
+        if (state.hasIncumbent && !IsBetter(solve.f, state))
+            break;
+
+        int column = -1;
+        bool up = false;
+        Fraqtion columnScore = 0;
+
+        for (int j = 0; j < n; j++) {
+            if (solve.x[j].IsInteger())
+                continue;
+
+            Fraqtion f = solve.x[j].GetRealPart();
+            bool roundUp = f >= Fraqtion(1, 2);
+            Fraqtion score = roundUp ? Fraqtion(1) - f : f;
+
+            if (guided && state.hasIncumbent) {
+                roundUp = state.incumbentX[j] > solve.x[j];
+                score = fabs(state.incumbentX[j] - solve.x[j]);
+            }
+
+            if (column == -1 || score < columnScore) {
+                column = j;
+                up = roundUp;
+                columnScore = score;
+            }
+        }
+
+        if (column == -1) {
+            TryHeuristicSolve(solve.x, state, source, solves);
+            break;
+        }
+
+        // x_j <= floor или -x_j <= -(floor + 1)
+        vector<Fraqtion> a(n, 0);
+        Fraqtion b = Floor(solve.x[column]);
+
+        a[column] = up ? -1 : 1;
+
+        if (up)
+            b = -(b + 1);
+
+        Fraqtion::overflow = false;
+        dive.AddStructuralRow(a, b);
+
+        if (!dive.DualIterations(10 * (dive.n + dive.m)) || Fraqtion::overflow || !dive.IsTableSafe())
+            break;
+
+        bool feasible = true;
+
+        for (int i = 0; i < dive.m && feasible; i++)
+            feasible = dive.table[i][dive.n + dive.m] >= 0;
+
+        if (!feasible)
+            break;
+    }
+
+    Fraqtion::overflow = Fraqtion::overflow || overflow; // переполнение, случившееся до ныряния, не теряется
+}
+
+// насос допустимости: чередуем проекцию на многогранник (минимум суммы |x - r| по LP)
+// и округление r = [x], при зацикливании переворачиваем самые далёкие координаты
+void Simplex::FeasibilityPump(const SimplexSolve &solve, BranchingState &state, vector<SimplexSolve> &solves) const {
+    vector<Fraqtion> r(n), previous;
+
+    for (int j = 0; j < n; j++)
+        r[j] = Floor(solve.x[j] + Fraqtion(1, 2));
+
+    for (int iteration = 0; iteration < state.pumpIterations; iteration++) {
+        if (TryHeuristicSolve(r, state, "feasibility pump", solves) || CheckSolve(r))
+            return;
+
+        // задача проекции: переменные x и d, ограничения узла, d_j >= |x_j - r_j|, min sum(d)
+        vector<vector<Fraqtion>> a;
+        vector<Fraqtion> b, c(2 * n, 0);
+        vector<ConstraintType> types;
+
+        for (int i = 0; i < initialA.size(); i++) {
+            vector<Fraqtion> row(2 * n, 0);
+
+            for (int j = 0; j < n; j++)
+                row[j] = initialA[i][j];
+
+            a.push_back(row);
+            b.push_back(initialB[i]);
+            types.push_back(initialTypes[i]);
+        }
+
+        for (int j = 0; j < n; j++) {
+            vector<Fraqtion> upper(2 * n, 0), lower(2 * n, 0);
+
+            upper[j] = 1;
+            upper[n + j] = -1;
+            lower[j] = 1;
+            lower[n + j] = 1;
+
+            a.push_back(upper);
+            b.push_back(r[j]);
+            types.push_back(ConstraintType::LessEqual);
+
+            a.push_back(lower);
+            b.push_back(r[j]);
+            types.push_back(ConstraintType::GreaterEqual);
+
+            c[n + j] = 1;
+        }
+
+        Simplex projection(a, b, c, types, SimplexMode::Min, padding);
+
+        if (!projection.Solve(false))
+            return;
+
+        SimplexSolve projected = projection.GetSolve();
+
+        // точка многогранника уже целая
+        if (TryHeuristicSolve(projected.x, state, "feasibility pump", solves))
+            return;
+
+        previous = r;
+
+        for (int j = 0; j < n; j++)
+            r[j] = Floor(projected.x[j] + Fraqtion(1, 2));
+
+        if (r != previous)
+            continue;
+
+        // зацикливание: сдвигаем к x координаты с наибольшим |x_j - r_j|
+        vector<pair<Fraqtion, int>> distances;
+
+        for (int j = 0; j < n; j++)
+            if (projected.x[j] != r[j])
+                distances.push_back({ fabs(projected.x[j] - r[j]), j });
+
+        if (distances.empty())
+            return;
+
+        sort(distances.begin(), distances.end(), [](const pair<Fraqtion, int> &a, const pair<Fraqtion, int> &b) {
+            return a.first > b.first;
+        });
+
+        for (int t = 0; t < distances.size() && t < max(1, n / 2); t++) {
+            int j = distances[t].second;
+            r[j] += projected.x[j] > r[j] ? 1 : -1;
+        }
+    }
+}
+
+// запуск эвристик в узле: округления всегда, ныряния и насос допустимости только в корне
+// или пока решение не найдено (они дороже)
+vector<SimplexSolve> Simplex::RunHeuristics(const SimplexSolve &solve, BranchingState &state, bool root) const {
+    vector<SimplexSolve> solves;
+
+    SimpleRounding(solve, state, solves);
+    ShiftRounding(solve, state, solves);
+    Diving(state, false, solves);
+
+    if (state.hasIncumbent)
+        Diving(state, true, solves);
+
+    if (root || !state.hasIncumbent)
+        FeasibilityPump(solve, state, solves);
+
+    return solves;
+}
+
+// итерации двойственного симплекс-метода (план остаётся оптимальным, исправляется допустимость)
+bool Simplex::DualIterations(int limit) {
+    for (int iteration = 0; iteration < limit; iteration++) {
+        CalculateDeltas();
+
+        // строка с наибольшим по модулю отрицательным свободным членом
+        int row = -1;
+
+        for (int i = 0; i < m; i++)
+            if (table[i][n + m] < 0 && (row == -1 || table[i][n + m] < table[row][n + m]))
+                row = i;
+
+        // план допустим
+        if (row == -1)
+            return true;
+
+        int column = -1;
+
+        for (int j = 0; j < n + m; j++) {
+            if (table[row][j] >= 0)
+                continue;
+
+            if (column == -1 || fabs(deltas[j] / table[row][j]) < fabs(deltas[column] / table[row][column]))
+                column = j;
+        }
+
+        // строку нельзя исправить, значит задача несовместна
+        if (column == -1)
+            return false;
+
+        Gauss(row, column);
+    }
+
+    CalculateDeltas();
+    return true;
+}
+
+// оценка ухудшения функции в дочерней задаче по нескольким двойственным итерациям на копии таблицы
+double Simplex::StrongBranch(int index, bool up, int limit) const {
+    Simplex child = *this;
+
+    int r = 0;
+    while (basis[r] != index)
+        r++;
+
+    // x = b - sum(t * x_k) по небазисным, отсюда x <= [b] и x >= [b] + 1 в небазисных переменных
+    Fraqtion f = table[r][n + m].GetRealPart();
+    vector<Fraqtion> row(n + m, 0);
+
+    for (int k = 0; k < n + m; k++)
+        if (!IsBasis(k))
+            row[k] = up ? table[r][k] : -table[r][k];
+
+    child.AddRow(row, up ? f - 1 : -f);
+
+    if (!child.DualIterations(limit))
+        return 1e9; // ветка несовместна и будет сразу отсечена
+
+    return fabs(child.deltas[child.n + child.m] - deltas[n + m]).ToDouble();
+}
+
+// выбор переменной для ветвления по заданному правилу
+int Simplex::GetBranchIndex(const SimplexSolve &solve, BranchingState &state) {
+    if (state.rule == BranchingRule::MostFractional)
+        return GetRealIndex(solve.x);
+
+    // кандидаты, упорядоченные по близости дробной части к 1/2
+    vector<pair<double, int>> candidates;
+
+    for (int i = 0; i < n; i++)
+        if (!solve.x[i].IsInteger())
+            candidates.push_back({ fabs(solve.x[i].GetRealPart().ToDouble() - 0.5), i });
+
+    sort(candidates.begin(), candidates.end());
+
+    int best = -1;
+    double bestScore = -1;
+
+    for (int t = 0; t < candidates.size(); t++) {
+        int index = candidates[t].second;
+        double f = solve.x[index].GetRealPart().ToDouble();
+        double down, up;
+
+        if (state.rule == BranchingRule::Pseudocost && state.downCount[index] >= state.reliability && state.upCount[index] >= state.reliability) {
+            down = state.downSum[index] / state.downCount[index] * f;
+            up = state.upSum[index] / state.upCount[index] * (1 - f);
+        }
+        else {
+            if (state.rule == BranchingRule::Strong && t >= state.strongCandidates)
+                break;
+
+            down = StrongBranch(index, false, state.strongIterations);
+            up = StrongBranch(index, true, state.strongIterations);
+
+            // ненадёжные псевдостоимости инициализируем оценками сильного ветвления
+            if (state.rule == BranchingRule::Pseudocost) {
+                if (down < 1e9) {
+                    state.downSum[index] += down / f;
+                    state.downCount[index]++;
+                }
+
+                if (up < 1e9) {
+                    state.upSum[index] += up / (1 - f);
+                    state.upCount[index]++;
+                }
+            }
+        }
+
+        double score = max(down, 1e-6) * max(up, 1e-6); // правило произведения
+
+        if (score > bestScore) {
+            bestScore = score;
+            best = index;
+        }
+    }
+
+    return best;
+}
+
+// добавление числа к хешу FNV-1a
+uint64_t Simplex::HashCombine(uint64_t hash, int value) const {
+    for (int i = 0; i < 4; i++) {
+        hash ^= (value >> (8 * i)) & 0xFF;
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// хеш начального ограничения: тип, свободный член и коэффициенты
+uint64_t Simplex::RowHash(int row) const {
+    uint64_t hash = 14695981039346656037ULL;
+
+    hash = HashCombine(hash, (int) initialTypes[row]);
+    hash = HashCombine(hash, initialB[row].GetN());
+    hash = HashCombine(hash, initialB[row].GetM());
+
+    for (int j = 0; j < n; j++) {
+        hash = HashCombine(hash, initialA[row][j].GetN());
+        hash = HashCombine(hash, initialA[row][j].GetM());
+    }
+
+    return hash;
+}
+
+// начальные ограничения в канонической нумерации: строки упорядочены по хешу,
+// поэтому одна и та же задача, полученная разным порядком ветвлений, нумеруется одинаково
+vector<int> Simplex::CanonicalRows() const {
+    vector<pair<uint64_t, int>> hashes;
+
+    for (int i = 0; i < initialA.size(); i++)
+        hashes.push_back({ RowHash(i), i });
+
+    sort(hashes.begin(), hashes.end());
+
+    vector<int> rows;
+
+    for (int i = 0; i < hashes.size(); i++)
+        rows.push_back(hashes[i].second);
+
+    return rows;
+}
+
+// каноническая запись задачи для кэша LP-релаксаций: n, число строк, режим, функция и ограничения
+// (вместе с границами ветвления) в канонической нумерации строк; кэш сравнивает её целиком
+vector<int32_t> Simplex::CacheProblem() const {
+    vector<int> rows = CanonicalRows();
+    vector<int32_t> problem = { n, (int32_t) rows.size(), mode == SimplexMode::Max ? 0 : 1 };
+
+    for (int j = 0; j < n; j++) {
+        problem.push_back(initialC[j].GetN());
+        problem.push_back(initialC[j].GetM());
+    }
+
+    for (int i = 0; i < rows.size(); i++) {
+        problem.push_back((int) initialTypes[rows[i]]);
+        problem.push_back(initialB[rows[i]].GetN());
+        problem.push_back(initialB[rows[i]].GetM());
+
+        for (int j = 0; j < n; j++) {
+            problem.push_back(initialA[rows[i]][j].GetN());
+            problem.push_back(initialA[rows[i]][j].GetM());
+        }
+    }
+
+    return problem;
+}
+
+// решение по записи кэша: задача без решения не решается вовсе,
+// иначе тёплый старт с закэшированного оптимального базиса
+bool Simplex::SolveFromCache(const LpCacheEntry &entry, bool debug) {
+    // в кэше только доказанные результаты: несовместность восстанавливается без решения
+    if (!entry.feasible) {
+        iterations = 0;
+        solved = false;
+        verifiedBasis.clear();
+        status = SolveStatus::Infeasible;
+
+        if (debug)
+            PrintStatus();
+
+        return false;
+    }
+
+    vector<int> rows = CanonicalRows();
+    vector<int> columns;
+
+    for (int i = 0; i < entry.basis.size(); i++) {
+        int column = entry.basis[i];
+
+        if (column >= n)
+            column = column - n < rows.size() ? n + rows[column - n] : -1;
+
+        columns.push_back(column);
+    }
+
+    SetStartBasis(columns);
+    return Solve(debug, CrashMode::User);
+}
+
+// сохранение результата решения в кэш (балансовые переменные - в канонической нумерации строк);
+// запоминаются только оптимум и несовместность - лимит, отмена, переполнение и неограниченность
+// не являются свойством задачи или не дают записи, по которой её можно восстановить
+void Simplex::StoreInCache(LpCache &cache, const vector<int32_t> &problem, bool result) const {
+    if (status != SolveStatus::Optimal && status != SolveStatus::Infeasible)
+        return;
+
+    LpCacheEntry entry;
+    entry.problem = problem;
+    entry.feasible = result;
+
+    if (result) {
+        vector<int> rows = CanonicalRows();
+        vector<int> position(rows.size());
+
+        for (int p = 0; p < rows.size(); p++)
+            position[rows[p]] = p;
+
+        entry.f = deltas[n + m];
+
+        for (int i = 0; i < m; i++)
+            entry.basis.push_back(basis[i] < n ? basis[i] : n + position[basis[i] - n]);
+    }
+
+    cache.Put(entry);
+}
+
+// учёт узла, решение которого прервано (лимит, отмена, переполнение), а не доказано пустым:
+// после него поиск уже не гарантирует оптимальность рекорда
+void Simplex::CountStopped(BranchingState &state) const {
+    if (status == SolveStatus::Infeasible || status == SolveStatus::Unbounded)
+        return;
+
+    state.stoppedNodes++;
+    state.stopStatus = status;
+}
+
+// решение с кэшем LP-релаксаций: при попадании решение восстанавливается по записи,
+// при промахе задача решается обычно и результат запоминается
+bool Simplex::SolveCached(LpCache &cache, bool debug) {
+    // к таблице уже добавлены строки (отсечения), её нельзя описать начальными условиями
+    if (m != initialA.size())
+        return Solve(debug);
+
+    vector<int32_t> problem = CacheProblem();
+    LpCacheEntry entry;
+
+    if (cache.Get(problem, entry))
+        return SolveFromCache(entry, debug);
+
+    bool result = Solve(debug);
+    StoreInCache(cache, problem, result);
+
+    return result;
+}
+
+// получение целочисленных решений
+vector<SimplexSolve> Simplex::SolveIntegerBranchesAndBorders(bool debug, int depth) {
+    BranchingState state;
+    return SolveIntegerBranchesAndBorders(state, debug, depth);
+}
+
+// получение целочисленных решений с выбором правила ветвления
+// обход идёт по явному стеку state.pending, поэтому поиск можно приостановить (pauseNodes, pause),
+// сохранить SaveBranching и продолжить тем же вызовом, в том числе после LoadBranching
+vector<SimplexSolve> Simplex::SolveIntegerBranchesAndBorders(BranchingState &state, bool debug, int depth) {
+    // пустой стек - новый поиск с корня, иначе продолжаем приостановленный
+    if (state.pending.empty()) {
+        BranchingNode root;
+        root.depth = depth;
+
+        state.pending.push_back(root);
+        state.found.clear();
+    }
+
+    int nodes = 0; // задачи, решённые этим вызовом
+
+    while (!state.pending.empty()) {
+        BranchingNode node = state.pending.back();
+
+        if (!node.update && ((state.pauseNodes > 0 && nodes == state.pauseNodes) || (state.pause && *state.pause))) {
+            int tasks = count_if(state.pending.begin(), state.pending.end(), [](const BranchingNode &item) { return !item.update; });
+            cout << string(padding, ' ') << "Search paused: " << tasks << " task(s) pending" << endl;
+            break;
+        }
+
+        state.pending.pop_back();
+
+        if (node.update) {
+            FinishBranching(node, state);
+        }
+        else {
+            SolveBranchingNode(node, state, debug);
+            nodes++;
+        }
+    }
+
+    // решения выдаются в порядке рекурсивного обхода: ветка вверх, ветка вниз, затем решения самого узла
+    vector<pair<string, SimplexSolve>> found = state.found;
+    stable_sort(found.begin(), found.end(), [](const pair<string, SimplexSolve> &a, const pair<string, SimplexSolve> &b) { return a.first < b.first; });
+
+    vector<SimplexSolve> solves;
+
+    for (int i = 0; i < found.size(); i++)
+        solves.push_back(found[i].second);
+
+    return solves; // возвращаем решения
+}
+
+// решение задачи из стека обхода: корень решается в этой задаче, остальные - по её начальным условиям с ограничениями узла
+void Simplex::SolveBranchingNode(const BranchingNode &node, BranchingState &state, bool debug) {
+    if (node.path.empty()) {
+        BranchNode(node, state, debug);
+        return;
+    }
+
+    vector<vector<Fraqtion>> a = initialA;
+    vector<Fraqtion> b = initialB;
+    vector<ConstraintType> types = initialTypes;
+
+    for (int i = 0; i < node.rows.size(); i++) {
+        a.push_back(node.rows[i].a);
+        b.push_back(node.rows[i].b);
+        types.push_back(node.rows[i].type);
+    }
+
+    Simplex simplex(a, b, initialC, types, mode, padding + 6 * node.path.size());
+    simplex.SetLimits(iterationLimit, timeLimit, cancel); // лимиты и флаг отмены действуют на LP каждого узла
+    simplex.BranchNode(node, state, debug);
+
+    // запоминаем итог дочерней задачи для обновления псевдостоимостей родителя
+    BranchingNode &update = state.pending[node.parent];
+
+    if (node.path.back() == '1') {
+        update.downSolved = simplex.solved;
+        update.downF = simplex.deltas[simplex.n + simplex.m];
+    }
+    else {
+        update.upSolved = simplex.solved;
+        update.upF = simplex.deltas[simplex.n + simplex.m];
+    }
+}
+
+// решение задачи узла: LP, отсечения, эвристики, отсечение по оценке и ветвление (дочерние задачи кладутся в стек)
+void Simplex::BranchNode(const BranchingNode &node, BranchingState &state, bool debug) {
+    cout << string(padding, ' ') << "Start solving task:" << endl;
+    PrintTask();
+
+    state.nodes++;
+    int initialRows = initialA.size(); // после них в начальные условия попадут отсечения узла
+
+    if (state.downSum.size() != n) {
+        state.downSum = vector<double>(n, 0);
+        state.upSum = vector<double>(n, 0);
+        state.downCount = vector<int>(n, 0);
+        state.upCount = vector<int>(n, 0);
+    }
+
+    // ветка, оценка которой уже известна из кэша и не лучше рекорда, отсекается без решения LP
+    LpCacheEntry cached;
+
+    if (state.cache && state.hasIncumbent && state.cache->Peek(CacheProblem(), cached) && cached.feasible && !IsBetter(cached.f, state)) {
+        cout << string(padding, ' ') << "Pruned by cached bound " << cached.f << endl << endl;
+        return;
+    }
+
+    // если решение не было найдено, то решений в узле нет (при debug причину уже вывел Solve)
+    if (!(state.cache ? SolveCached(*state.cache, debug) : Solve(debug))) {
+        if (!debug)
+            PrintStatus();
+
+        CountStopped(state);
+        return;
+    }
+
+    // усиливаем релаксацию отсечениями из пула и новыми отсечениями
+    if (state.cuts && !CutRounds(state, node.depth == 0 ? state.rootCutRounds : state.localCutRounds, node.depth == 0)) {
+        if (status == SolveStatus::Infeasible)
+            cout << string(padding, ' ') << "Cuts proved the task infeasible" << endl << endl;
+        else
+            PrintStatus();
+
+        CountStopped(state);
+        return;
+    }
+
+    SimplexSolve solve = GetSolve(); // получаем решение
+    PrintSolve(solve);
+    cout << endl;
+
+    // эвристики ищут целочисленные решения для отсечения веток по оценке
+    vector<SimplexSolve> solves;
+
+    if (state.heuristics && (node.depth == 0 || (state.heuristicFrequency > 0 && state.nodes % state.heuristicFrequency == 0)))
+        solves = RunHeuristics(solve, state, node.depth == 0);
+
+    int realIndex = -1;
+
+    // если оценка не лучше найденного целочисленного решения, то ветку отсекаем
+    if (state.hasIncumbent && !IsBetter(solve.f, state)) {
+        cout << string(padding, ' ') << "Pruned by bound " << state.incumbent << endl << endl;
+    }
+    else {
+        realIndex = GetBranchIndex(solve, state); // ищем переменную для ветвления
+
+        // если решение содержало только целые числа, то это решение узла
+        if (realIndex == -1) {
+            UpdateIncumbent(solve, state, "LP");
+            solves.push_back(solve);
+        }
+    }
+
+    for (int i = 0; i < solves.size(); i++)
+        state.found.push_back({ node.path + '2', solves[i] });
+
+    if (realIndex == -1)
+        return;
+
+    Fraqtion b = solve.x[realIndex].GetIntPart(); // получаем новое условие
+
+    cout << string(padding, ' ') << "Divide to tasks: x" << (realIndex + 1) << " <= " << b << " and x" << (realIndex + 1) << " >= " << (b + 1) << endl;
+
+    // под дочерними задачами лежит обновление псевдостоимостей по фактическому ухудшению функции в них
+    BranchingNode update;
+    update.update = true;
+    update.depth = node.depth;
+    update.path = node.path;
+    update.index = realIndex;
+    update.fraction = solve.x[realIndex].GetRealPart();
+    update.f = solve.f;
+    state.pending.push_back(update);
+
+    // разбиваем задачу на 2 ветки решения: x <= b и x >= b + 1
+    BranchingNode down, up;
+    down.depth = up.depth = node.depth + 1;
+    down.parent = up.parent = state.pending.size() - 1;
+    down.path = node.path + '1';
+    up.path = node.path + '0';
+    down.rows = node.rows;
+
+    // дочерние задачи наследуют отсечения узла (отсечения корня уже в начальных условиях этой задачи)
+    if (!node.path.empty())
+        for (int i = initialRows; i < initialA.size(); i++)
+            down.rows.push_back({ initialA[i], initialB[i], initialTypes[i] });
+
+    up.rows = down.rows;
+
+    BranchRow bound;
+    bound.a = vector<Fraqtion>(n, 0);
+    bound.a[realIndex] = 1;
+
+    bound.b = b;
+    bound.type = ConstraintType::LessEqual;
+    down.rows.push_back(bound);
+
+    bound.b = b + 1;
+    bound.type = ConstraintType::GreaterEqual;
+    up.rows.push_back(bound);
+
+    bool upFirst = state.order == ChildOrder::UpFirst || (state.order == ChildOrder::Nearest && update.fraction >= Fraqtion(1, 2));
+
+    // первой решается задача на вершине стека
+    state.pending.push_back(upFirst ? down : up);
+    state.pending.push_back(upFirst ? up : down);
+}
+
+// обновление псевдостоимостей после решения обеих дочерних задач и итоги поиска в корне
+void Simplex::FinishBranching(const BranchingNode &node, BranchingState &state) const {
+    double f = node.fraction.ToDouble();
+
+    if (node.downSolved) {
+        state.downSum[node.index] += fabs(node.downF - node.f).ToDouble() / f;
+        state.downCount[node.index]++;
+    }
+
+    if (node.upSolved) {
+        state.upSum[node.index] += fabs(node.upF - node.f).ToDouble() / (1 - f);
+        state.upCount[node.index]++;
+    }
+
+    string indent(padding + 6 * node.path.size(), ' ');
+
+    if (node.depth == 0 && state.hasIncumbent)
+        cout << indent << "First incumbent: node " << state.firstIncumbentNode << ", " << state.firstIncumbentSeconds * 1000 << " ms (" << state.firstIncumbentSource << ")" << endl;
+
+    if (node.depth == 0 && state.stoppedNodes > 0)
+        cout << indent << "Search incomplete: " << state.stoppedNodes << " node(s) stopped, best solve is not proven optimal" << endl;
+}
+
+// поиск решений методом грубой силы
+vector<SimplexSolve> Simplex::SolveIntegerBruteforce(int nmax) {
+    vector<SimplexSolve> solves;
+    cout << "Bruteforce solves: " << endl;
+
+    for (int x1 = 0; x1 <= nmax; x1++) {
+        for (int x2 = 0; x2 <= nmax; x2++) {
+            for (int x3 = 0; x3 <= nmax; x3++) {
+                SimplexSolve solve;
+                solve.x = { x1, x2, x3 };
+
+                if (!CheckSolve(solve.x)) // если решение не подходит под ограничения
+                    continue; // то пропускаем
+
+                solve.f = 0;
+
+                for (int i = 0; i < n; i++)
+                    solve.f += c[i] * solve.x[i]; // считаем значение функции
+
+                PrintSolve(solve);
+                solves.push_back(solve); // добавляем решение
+            }
+        }
+    }
+
+    return solves; // возвраащем решения
+}
+
+// поиск решения методом Гомори
+vector<SimplexSolve> Simplex::SolveGomory(bool debug) {
+    cout << string(padding, ' ') << "Start solving task:" << endl;
+    PrintTask();
+
+    // если решение не было найдено, то добавляем пустое решение (при debug причину уже вывел Solve)
+    if (!Solve(debug)) {
+        if (!debug)
+            PrintStatus();
+
+        return {};
+    }
+
+    SimplexSolve solve = GetSolve(); // получаем решение
+    PrintSolve(solve);
+    cout << endl;
+
+    int realIndex = GetRealIndex(solve.x); // ищем вещественное решение
+
+    // если решение содержало только целые числа, то возвращаем решение
+    if (realIndex == -1)
+        return { solve };
+
+    // ищем строку с этой базисной переменной
+    int index = 0;
+    while (basis[index] != realIndex)
+        index++;
+
+    AddRow(GomoryRow(index), -1);
 
     cout << "Add GOMORY restriction" << endl;
     return SolveGomory(debug);
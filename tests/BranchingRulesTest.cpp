@@ -0,0 +1,140 @@
+// сборка: g++ -std=c++17 -O2 tests/BranchingRulesTest.cpp -o BranchingRulesTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+// случайная задача max c·x, a·x <= b с положительными целыми коэффициентами и правыми частями до 39
+LpTask SmallTask(int seed, int n, int m) {
+    TaskShape shape;
+    shape.rhsHigh = 39;
+
+    return RandomTask(seed, n, m, shape);
+}
+
+// оптимум перебором целых точек (каждая переменная не больше min b / a по строкам)
+Fraqtion Bruteforce(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const vector<Fraqtion> &c) {
+    int n = c.size();
+    vector<int> x(n, 0), limit(n, INT_MAX);
+
+    for (int i = 0; i < a.size(); i++)
+        for (int j = 0; j < n; j++)
+            limit[j] = min(limit[j], (b[i] / a[i][j]).GetIntPart().GetN());
+
+    Fraqtion best = 0;
+
+    while (true) {
+        bool feasible = true;
+
+        for (int i = 0; i < a.size() && feasible; i++) {
+            Fraqtion sum = 0;
+
+            for (int j = 0; j < n; j++)
+                sum += a[i][j] * x[j];
+
+            feasible = sum <= b[i];
+        }
+
+        if (feasible) {
+            Fraqtion f = 0;
+
+            for (int j = 0; j < n; j++)
+                f += c[j] * x[j];
+
+            best = max(best, f);
+        }
+
+        int j = 0;
+
+        while (j < n && x[j] == limit[j])
+            x[j++] = 0;
+
+        if (j == n)
+            return best;
+
+        x[j]++;
+    }
+}
+
+// каждое правило при каждом порядке обхода находит оптимум перебора; псевдостоимости и сильное ветвление
+// в сумме решают не больше узлов, чем наибольшая дробная часть
+void TestRules() {
+    BranchingRule rules[] = { BranchingRule::MostFractional, BranchingRule::Pseudocost, BranchingRule::Strong };
+    ChildOrder orders[] = { ChildOrder::DownFirst, ChildOrder::UpFirst, ChildOrder::Nearest };
+    int nodes[3] = { 0 };
+
+    for (int seed = 0; seed < 15; seed++) {
+        LpTask task = SmallTask(seed, 4, 5);
+        Fraqtion best = Bruteforce(task.a, task.b, task.c);
+
+        for (int rule = 0; rule < 3; rule++) {
+            for (ChildOrder order : orders) {
+                CoutCapture capture;
+                BranchingState state;
+                state.rule = rules[rule];
+                state.order = order;
+
+                Simplex simplex = task.Build();
+                vector<SimplexSolve> solves = simplex.SolveIntegerBranchesAndBorders(state, false);
+
+                CHECK(!solves.empty());
+                CHECK(state.hasIncumbent);
+                CHECK(state.stoppedNodes == 0);
+                CHECK(state.incumbent == best);
+                CHECK(state.incumbentNode >= 1 && state.incumbentNode <= state.nodes);
+                CHECK(state.incumbentSeconds >= 0);
+
+                if (order == ChildOrder::DownFirst)
+                    nodes[rule] += state.nodes;
+            }
+        }
+    }
+
+    CHECK(nodes[1] <= nodes[0]);
+    CHECK(nodes[2] <= nodes[0]);
+}
+
+// псевдостоимости заполняются наблюдениями (сильным ветвлением и по дочерним задачам), суммы неотрицательны
+void TestPseudocosts() {
+    CoutCapture capture;
+    BranchingState state;
+    state.rule = BranchingRule::Pseudocost;
+
+    Simplex simplex = SmallTask(3, 5, 6).Build();
+    simplex.SolveIntegerBranchesAndBorders(state, false);
+
+    int observations = 0;
+
+    for (int j = 0; j < 5; j++) {
+        observations += state.downCount[j] + state.upCount[j];
+        CHECK(state.downSum[j] >= 0 && state.upSum[j] >= 0);
+        CHECK(state.downCount[j] > 0 || state.downSum[j] == 0);
+        CHECK(state.upCount[j] > 0 || state.upSum[j] == 0);
+    }
+
+    CHECK(state.nodes > 1);
+    CHECK(observations > 0);
+}
+
+// ветка, оценка которой не лучше рекорда, отсекается, и это видно в выводе
+void TestBoundPruning() {
+    int pruned = 0;
+
+    for (int seed = 0; seed < 10; seed++) {
+        CoutCapture capture;
+        BranchingState state;
+
+        Simplex simplex = SmallTask(seed, 5, 6).Build();
+        simplex.SolveIntegerBranchesAndBorders(state, false);
+
+        pruned += capture.Text().find("Pruned by bound") != string::npos;
+    }
+
+    CHECK(pruned > 0);
+}
+
+int main() {
+    TestRules();
+    TestPseudocosts();
+    TestBoundPruning();
+
+    return CheckResult("BranchingRulesTest");
+}
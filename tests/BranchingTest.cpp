@@ -0,0 +1,234 @@
+// сборка: g++ -std=c++17 -O2 tests/BranchingTest.cpp -o BranchingTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+const string BRANCHING_PATH = TempPath("branching_test.bin"); // снимок при паузах
+const string GOOD_PATH = TempPath("branching_good.bin"), BAD_PATH = TempPath("branching_bad.bin"); // исправный и испорченный снимки
+
+// max 7x1 + 6x2 + 9x3 + 8x4: без отсечений дерево из нескольких десятков узлов
+Simplex Task() {
+    vector<vector<Fraqtion>> a = { { 3, 2, 5, 4 }, { Fraqtion(7, 2), 4, 1, 3 }, { 2, 5, 3, Fraqtion(5, 3) } };
+    return Simplex(a, { 17, 19, 16 }, { 7, 6, 9, 8 }, SimplexMode::Max);
+}
+
+// псевдостоимости, локальные отсечения (наследуются дочерними задачами) и эвристики
+BranchingState CutsState() {
+    BranchingState state;
+    state.rule = BranchingRule::Pseudocost;
+    state.order = ChildOrder::Nearest;
+    state.cuts = true;
+    state.rootCutRounds = 0;
+    state.maxCutsPerRound = 1;
+    state.heuristics = true;
+    state.heuristicFrequency = 2;
+
+    return state;
+}
+
+// итог поиска для сравнения: решения, статистика и вывод без времён и сообщений о паузе
+struct Outcome {
+    vector<SimplexSolve> solves;
+    BranchingState state;
+    string text;
+};
+
+string StripVolatile(const string &text) {
+    istringstream in(text);
+    string line, result;
+
+    while (getline(in, line))
+        if (line.find(" ms (") == string::npos && line.find("Search paused") == string::npos)
+            result += line + "\n";
+
+    return result;
+}
+
+// поиск без перерывов
+Outcome Uninterrupted(BranchingState state) {
+    Outcome outcome;
+    CoutCapture capture;
+
+    Simplex simplex = Task();
+    outcome.solves = simplex.SolveIntegerBranchesAndBorders(state, false);
+    outcome.state = state;
+    outcome.text = StripVolatile(capture.Text());
+
+    return outcome;
+}
+
+// поиск с паузой через каждые step узлов; при viaFile каждая пауза - сохранение и загрузка в новую задачу
+Outcome Paused(BranchingState state, int step, bool viaFile, int &pauses) {
+    Outcome outcome;
+    CoutCapture capture;
+
+    Simplex simplex = Task();
+    state.pauseNodes = step;
+    pauses = 0;
+
+    while (true) {
+        outcome.solves = simplex.SolveIntegerBranchesAndBorders(state, false);
+
+        if (state.pending.empty())
+            break;
+
+        pauses++;
+
+        if (viaFile) {
+            CHECK(simplex.SaveBranching(BRANCHING_PATH, state));
+
+            BranchingState fresh;
+            fresh.pauseNodes = step;
+
+            // загрузка заменяет задачу, поэтому подходит любая
+            simplex = Simplex({ { 1 } }, { 1 }, { 1 }, SimplexMode::Min);
+            CHECK(simplex.LoadBranching(BRANCHING_PATH, fresh));
+            state = fresh;
+        }
+    }
+
+    outcome.state = state;
+    outcome.text = StripVolatile(capture.Text());
+
+    return outcome;
+}
+
+// продолженный поиск совпадает с непрерывным: решения, узлы, рекорд, псевдостоимости и ход решения
+void CheckSame(const Outcome &expected, const Outcome &actual) {
+    CHECK(actual.solves.size() == expected.solves.size());
+
+    for (int i = 0; i < actual.solves.size() && i < expected.solves.size(); i++) {
+        CHECK(actual.solves[i].x == expected.solves[i].x);
+        CHECK(actual.solves[i].f == expected.solves[i].f);
+    }
+
+    CHECK(actual.state.nodes == expected.state.nodes);
+    CHECK(actual.state.incumbent == expected.state.incumbent);
+    CHECK(actual.state.incumbentX == expected.state.incumbentX);
+    CHECK(actual.state.incumbentNode == expected.state.incumbentNode);
+    CHECK(actual.state.cutsAdded == expected.state.cutsAdded);
+    CHECK(actual.state.downCount == expected.state.downCount);
+    CHECK(actual.state.upCount == expected.state.upCount);
+    CHECK(actual.state.downSum == expected.state.downSum);
+    CHECK(actual.state.upSum == expected.state.upSum);
+    CHECK(actual.text == expected.text);
+}
+
+// пауза по числу узлов в памяти и через файл для обеих настроек
+void TestResume() {
+    BranchingState configs[] = { BranchingState(), CutsState() };
+
+    for (BranchingState &config : configs) {
+        Outcome expected = Uninterrupted(config);
+        CHECK(expected.state.hasIncumbent);
+        CHECK(expected.state.nodes > 5);
+
+        for (int step : { 1, 3 }) {
+            for (bool viaFile : { false, true }) {
+                int pauses;
+                Outcome actual = Paused(config, step, viaFile, pauses);
+
+                CHECK(pauses >= expected.state.nodes / step - 1);
+                CheckSame(expected, actual);
+            }
+        }
+    }
+
+    remove(BRANCHING_PATH.c_str());
+}
+
+// установленный флаг паузы останавливает поиск до первого узла, снятый - продолжает его
+void TestPauseFlag() {
+    CoutCapture capture;
+    atomic<bool> pause(true);
+
+    BranchingState state;
+    state.pause = &pause;
+
+    Simplex simplex = Task();
+    CHECK(simplex.SolveIntegerBranchesAndBorders(state, false).empty());
+    CHECK(state.nodes == 0);
+    CHECK(state.pending.size() == 1);
+    CHECK(capture.Text().find("Search paused: 1 task(s) pending") != string::npos);
+
+    pause = false;
+    CHECK(!simplex.SolveIntegerBranchesAndBorders(state, false).empty());
+    CHECK(state.pending.empty());
+    CHECK(state.incumbent == 37);
+}
+
+// запись байтов в файл по смещению
+void Patch(const string &path, long offset, const vector<int32_t> &values) {
+    fstream file(path, ios::binary | ios::in | ios::out);
+    file.seekp(offset);
+    file.write((const char *) values.data(), values.size() * sizeof(int32_t));
+}
+
+// испорченный или обрезанный снимок не загружается и не меняет ни задачу, ни поиск
+void TestCorruption() {
+    CoutCapture capture;
+
+    BranchingState state;
+    state.pauseNodes = 4;
+
+    Simplex simplex = Task();
+    simplex.SolveIntegerBranchesAndBorders(state, false);
+    CHECK(!state.pending.empty());
+    CHECK(simplex.SaveBranching(GOOD_PATH, state));
+
+    ifstream in(GOOD_PATH, ios::binary);
+    string bytes((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    in.close();
+
+    // заголовок 20 байт, корневая задача: 3 строки по 4 дроби и типу, 3 правые части, 4 коэффициента функции
+    long settings = 20 + 3 * (4 * 8 + 4) + 3 * 8 + 4 * 8;
+
+    vector<pair<string, function<void(const string &)>>> corruptions = {
+        { "magic", [](const string &path) { Patch(path, 0, { 0 }); } },
+        { "version", [](const string &path) { Patch(path, 4, { 99 }); } },
+        { "columns", [](const string &path) { Patch(path, 8, { SNAPSHOT_SIZE_LIMIT + 1 }); } },
+        { "mode", [](const string &path) { Patch(path, 16, { 2 }); } },
+        { "rule", [&](const string &path) { Patch(path, settings, { 3 }); } },
+        { "frequency", [&](const string &path) { Patch(path, settings + 18 * 4, { -1 }); } },
+        { "truncated", [&](const string &path) { ofstream(path, ios::binary).write(bytes.data(), bytes.size() - 5); } }
+    };
+
+    for (auto &corruption : corruptions) {
+        ofstream(BAD_PATH, ios::binary).write(bytes.data(), bytes.size());
+        corruption.second(BAD_PATH);
+
+        BranchingState loaded;
+        loaded.nodes = -1;
+
+        Simplex other({ { 1 } }, { 1 }, { 1 }, SimplexMode::Min);
+
+        if (other.LoadBranching(BAD_PATH, loaded))
+            cerr << "corruption accepted: " << corruption.first << endl;
+
+        CHECK(loaded.nodes == -1);
+        CHECK(loaded.pending.empty());
+
+        other.Solve(false);
+        CHECK(other.GetSolve().f == 0);
+    }
+
+    // исправный снимок продолжает поиск до того же рекорда
+    BranchingState loaded;
+    Simplex other({ { 1 } }, { 1 }, { 1 }, SimplexMode::Min);
+    CHECK(other.LoadBranching(GOOD_PATH, loaded));
+    CHECK(loaded.nodes == 4);
+
+    other.SolveIntegerBranchesAndBorders(loaded, false);
+    CHECK(loaded.pending.empty());
+    CHECK(loaded.incumbent == 37);
+
+    remove(GOOD_PATH.c_str());
+    remove(BAD_PATH.c_str());
+}
+
+int main() {
+    TestResume();
+    TestPauseFlag();
+    TestCorruption();
+
+    return CheckResult("BranchingTest");
+}
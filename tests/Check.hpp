@@ -0,0 +1,180 @@
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <filesystem>
+#include "../simplex.hpp"
+#include "../FixedSimplex.hpp"
+
+int checkFailures = 0; // количество невыполненных проверок
+
+// проверка условия: при неудаче выводится место и текст условия, тест продолжается
+#define CHECK(condition) do { \
+    if (!(condition)) { \
+        std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" << #condition << ") failed" << std::endl; \
+        checkFailures++; \
+    } \
+} while (0)
+
+// перехват стандартного вывода на время жизни объекта (решатели печатают ход решения в cout)
+class CoutCapture {
+    std::ostringstream buffer;
+    std::streambuf *saved;
+public:
+    CoutCapture() : saved(std::cout.rdbuf(buffer.rdbuf())) {}
+    ~CoutCapture() { std::cout.rdbuf(saved); }
+
+    std::string Text() const { return buffer.str(); }
+};
+
+// итог теста: код возврата процесса
+int CheckResult(const std::string &name) {
+    std::cerr << name << ": " << (checkFailures == 0 ? "OK" : std::to_string(checkFailures) + " failed") << std::endl;
+    return checkFailures == 0 ? 0 : 1;
+}
+
+// путь к файлу name во временном каталоге системы (тесты не оставляют файлов в рабочем каталоге)
+std::string TempPath(const std::string &name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// условия задачи для конструктора Simplex
+struct LpTask {
+    std::vector<std::vector<Fraqtion>> a;
+    std::vector<Fraqtion> b, c;
+    std::vector<ConstraintType> types;
+    SimplexMode mode = SimplexMode::Max;
+
+    Simplex Build() const {
+        return Simplex(a, b, c, types, mode);
+    }
+};
+
+// та же задача N x M в FixedSimplex (ограничения a·x <= b)
+template <int N, int M>
+FixedSimplex<N, M> BuildFixed(const LpTask &task) {
+    std::array<std::array<Fraqtion, N>, M> a;
+    std::array<Fraqtion, M> b;
+    std::array<Fraqtion, N> c;
+
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++)
+            a[i][j] = task.a[i][j];
+
+        b[i] = task.b[i];
+    }
+
+    for (int j = 0; j < N; j++)
+        c[j] = task.c[j];
+
+    return FixedSimplex<N, M>(a, b, c, task.mode);
+}
+
+// вид случайной задачи RandomTask: диапазоны числителей, знаменатели и доля строк >=
+struct TaskShape {
+    int low = 1, high = 9; // коэффициенты ограничений
+    int rhsLow = 10, rhsHigh = 59; // правые части
+    int costLow = 1, costHigh = 9; // коэффициенты функции
+    int denominators = 1; // знаменатели коэффициентов ограничений от 1 до denominators (1 - целые числа)
+    int rhsDenominators = 1, costDenominators = 1; // то же для правых частей и функции
+    int greaterEqual = 0; // строка >= с вероятностью 1 / greaterEqual (0 - все строки <=, 1 - все >=)
+    SimplexMode mode = SimplexMode::Max;
+};
+
+// число из [low, high] со знаменателем от 1 до denominators
+Fraqtion RandomValue(int low, int high, int denominators) {
+    if (denominators == 1)
+        return rand() % (high - low + 1) + low;
+
+    return Fraqtion(rand() % (high - low + 1) + low, rand() % denominators + 1);
+}
+
+// случайная задача c·x -> max (min), a·x <= b (>=) с плотной матрицей m x n; по умолчанию
+// положительные целые коэффициенты, поэтому задача max с a·x <= b совместна и ограничена
+LpTask RandomTask(int seed, int n, int m, const TaskShape &shape = TaskShape()) {
+    srand(seed);
+    LpTask task;
+    task.mode = shape.mode;
+
+    for (int i = 0; i < m; i++) {
+        std::vector<Fraqtion> row(n);
+
+        for (int j = 0; j < n; j++)
+            row[j] = RandomValue(shape.low, shape.high, shape.denominators);
+
+        task.a.push_back(row);
+        task.b.push_back(RandomValue(shape.rhsLow, shape.rhsHigh, shape.rhsDenominators));
+
+        bool greater = shape.greaterEqual == 1 || (shape.greaterEqual > 1 && rand() % shape.greaterEqual == shape.greaterEqual - 1);
+        task.types.push_back(greater ? ConstraintType::GreaterEqual : ConstraintType::LessEqual);
+    }
+
+    for (int j = 0; j < n; j++)
+        task.c.push_back(RandomValue(shape.costLow, shape.costHigh, shape.costDenominators));
+
+    return task;
+}
+
+// дробная задача со смешанными знаками и ограничениями <=, >= (часто несовместная или с переполнением)
+TaskShape FractionalShape(int denominators) {
+    TaskShape shape;
+    shape.low = -4;
+    shape.high = 14;
+    shape.rhsLow = -10;
+    shape.rhsHigh = 39;
+    shape.costLow = -2;
+    shape.costHigh = 6;
+    shape.denominators = shape.rhsDenominators = shape.costDenominators = denominators;
+    shape.greaterEqual = 2;
+
+    return shape;
+}
+
+// задача max c·x, a·x <= b с крупными взаимно простыми дробями, на которой таблица часто переполняет int
+TaskShape IllConditionedShape(int denominators = 97) {
+    TaskShape shape;
+    shape.high = 2000;
+    shape.rhsLow = 100;
+    shape.rhsHigh = 5099;
+    shape.costHigh = 50;
+    shape.denominators = denominators;
+
+    return shape;
+}
+
+// совместная задача max c·x со смешанными ограничениями <=, >=, =: правые части строятся по целой
+// точке x0, последняя строка - бюджет a·x <= b со всеми положительными коэффициентами, поэтому функция
+// ограничена; остальные строки разреженные (ненулевой коэффициент от 1 до 3 с вероятностью 1 / density)
+LpTask FeasibleTask(int seed, int n, int m, int density = 3, int costHigh = 9) {
+    srand(seed);
+    LpTask task;
+    std::vector<int> x0(n);
+
+    for (int j = 0; j < n; j++) {
+        x0[j] = rand() % 4;
+        task.c.push_back(rand() % costHigh + 1);
+    }
+
+    for (int i = 0; i < m; i++) {
+        std::vector<Fraqtion> row(n);
+        int sum = 0;
+
+        for (int j = 0; j < n; j++) {
+            int value = i == m - 1 ? rand() % 3 + 1 : (rand() % density == 0 ? rand() % 3 + 1 : 0);
+            row[j] = value;
+            sum += value * x0[j];
+        }
+
+        int kind = i == m - 1 ? 0 : rand() % 3;
+        ConstraintType type = kind == 0 ? ConstraintType::LessEqual : kind == 1 ? ConstraintType::GreaterEqual : ConstraintType::Equal;
+
+        task.a.push_back(row);
+        task.b.push_back(type == ConstraintType::LessEqual ? sum + rand() % 4 : type == ConstraintType::GreaterEqual ? std::max(sum - rand() % 4, 0) : sum);
+        task.types.push_back(type);
+    }
+
+    return task;
+}
@@ -0,0 +1,98 @@
+// сборка: g++ -std=c++17 -O2 tests/CrashTest.cpp -o CrashTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+const string BASIS_PATH = TempPath("crash_test_basis.txt");
+
+// все способы начального базиса приходят к тому же оптимуму
+void TestAgreement() {
+    CrashMode modes[] = { CrashMode::Triangular, CrashMode::InteriorPoint };
+
+    for (int size = 4; size <= 10; size += 3) {
+        for (int seed = 0; seed < 40; seed++) {
+            LpTask task = FeasibleTask(seed, size, size);
+
+            Simplex slack = task.Build();
+            CHECK(slack.Solve(false));
+
+            for (CrashMode mode : modes) {
+                Simplex crashed = task.Build();
+                CHECK(crashed.Solve(false, mode));
+                CHECK(crashed.GetStatus() == SolveStatus::Optimal);
+                CHECK(crashed.GetSolve().f == slack.GetSolve().f);
+            }
+        }
+    }
+}
+
+// тёплый старт из оптимального базиса приходит к тому же оптимуму и в сумме тратит меньше итераций:
+// вводятся столбцы базиса (в том числе избыточные переменные строк >=), а недопустимость после ввода
+// исправляет первая фаза
+void TestWarmStart() {
+    int coldIterations = 0, warmIterations = 0;
+
+    for (int seed = 0; seed < 40; seed++) {
+        LpTask task = FeasibleTask(seed, 8, 8);
+
+        Simplex cold = task.Build();
+        CHECK(cold.Solve(false));
+
+        Simplex warm = task.Build();
+        warm.SetStartBasis(cold.GetBasis());
+        CHECK(warm.Solve(false, CrashMode::User));
+        CHECK(warm.GetSolve().f == cold.GetSolve().f);
+
+        coldIterations += cold.GetIterations();
+        warmIterations += warm.GetIterations();
+    }
+
+    CHECK(warmIterations < coldIterations);
+}
+
+// базис, сохранённый в файл, даёт тот же тёплый старт, что и заданный напрямую
+void TestBasisFile() {
+    LpTask task = FeasibleTask(7, 8, 8);
+
+    Simplex cold = task.Build();
+    CHECK(cold.Solve(false));
+    CHECK(cold.SaveBasis(BASIS_PATH));
+
+    Simplex direct = task.Build();
+    direct.SetStartBasis(cold.GetBasis());
+    CHECK(direct.Solve(false, CrashMode::User));
+
+    Simplex loaded = task.Build();
+    CHECK(loaded.LoadBasis(BASIS_PATH));
+    CHECK(loaded.Solve(false, CrashMode::User));
+    CHECK(loaded.GetIterations() == direct.GetIterations());
+    CHECK(loaded.GetSolve().f == cold.GetSolve().f);
+
+    CHECK(!loaded.LoadBasis(TempPath("crash_test_missing.txt")));
+    remove(BASIS_PATH.c_str());
+}
+
+// несовместность и неограниченность распознаются при любом начальном базисе
+void TestStatuses() {
+    CrashMode modes[] = { CrashMode::Slack, CrashMode::Triangular, CrashMode::InteriorPoint };
+
+    for (CrashMode mode : modes) {
+        // x1 + x2 = 4, x1 + x2 >= 6
+        Simplex infeasible({ { 1, 1 }, { 1, 1 } }, { 4, 6 }, { 1, 1 }, { ConstraintType::Equal, ConstraintType::GreaterEqual }, SimplexMode::Max);
+        CHECK(!infeasible.Solve(false, mode));
+        CHECK(infeasible.GetStatus() == SolveStatus::Infeasible);
+
+        // max x1 + x2: x1 - x2 = 1
+        Simplex unbounded({ { 1, -1 } }, { 1 }, { 1, 1 }, { ConstraintType::Equal }, SimplexMode::Max);
+        CHECK(!unbounded.Solve(false, mode));
+        CHECK(unbounded.GetStatus() == SolveStatus::Unbounded);
+    }
+}
+
+int main() {
+    TestAgreement();
+    TestWarmStart();
+    TestBasisFile();
+    TestStatuses();
+
+    return CheckResult("CrashTest");
+}
@@ -0,0 +1,127 @@
+// сборка: g++ -std=c++17 -O2 tests/DualTest.cpp -o DualTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+// точка x (основные и балансовые переменные) удовлетворяет ограничениям и даёт значение функции f
+bool Feasible(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const vector<Fraqtion> &c, const vector<ConstraintType> &types, const SimplexSolve &solve) {
+    int n = c.size();
+    Fraqtion f = 0;
+
+    for (int j = 0; j < n; j++) {
+        if (solve.x[j] < 0)
+            return false;
+
+        f += c[j] * solve.x[j];
+    }
+
+    for (int i = 0; i < a.size(); i++) {
+        Fraqtion sum = 0;
+
+        for (int j = 0; j < n; j++)
+            sum += a[i][j] * solve.x[j];
+
+        if (types[i] == ConstraintType::LessEqual ? sum > b[i] : types[i] == ConstraintType::GreaterEqual ? sum < b[i] : sum != b[i])
+            return false;
+
+        if (types[i] != ConstraintType::Equal && solve.x[n + i] < 0)
+            return false;
+    }
+
+    return f == solve.f;
+}
+
+// Solve, SolveDual и SolveAuto дают одно состояние и значение функции, точка двойственного ответа допустима
+void TestAgreement() {
+    int shapes[][2] = { { 3, 6 }, { 6, 3 }, { 5, 5 }, { 2, 9 } };
+    int compared = 0;
+
+    for (auto &shape : shapes) {
+        for (int seed = 0; seed < 100; seed++) {
+            LpTask task = FeasibleTask(seed, shape[0], shape[1], 2, 5); // на min функция неотрицательна, поэтому ограничена
+
+            task.mode = seed % 2 ? SimplexMode::Min : SimplexMode::Max;
+            SimplexSolve dualSolve, autoSolve;
+
+            Simplex primal = task.Build();
+            Simplex dual = task.Build();
+            Simplex automatic = task.Build();
+
+            bool result = primal.Solve(false);
+
+            if (primal.GetStatus() == SolveStatus::Overflow)
+                continue;
+
+            CHECK(result);
+            CHECK(dual.SolveDual(dualSolve, false) == result);
+            CHECK(automatic.SolveAuto(autoSolve, false) == result);
+            CHECK(dual.GetStatus() == primal.GetStatus());
+            CHECK(automatic.GetStatus() == primal.GetStatus());
+
+            if (!result)
+                continue;
+
+            CHECK(dualSolve.f == primal.GetSolve().f);
+            CHECK(autoSolve.f == primal.GetSolve().f);
+            CHECK(dualSolve.x.size() == shape[0] + shape[1]);
+            CHECK(Feasible(task.a, task.b, task.c, task.types, dualSolve));
+            compared++;
+        }
+    }
+
+    CHECK(compared > 300);
+}
+
+// несовместная прямая (двойственная не ограничена или несовместна) и неограниченная прямая
+void TestStatuses() {
+    for (SimplexMode mode : { SimplexMode::Max, SimplexMode::Min }) {
+        SimplexSolve solve;
+
+        // x1 + x2 <= 4, x1 + x2 >= 6
+        Simplex infeasible({ { 1, 1 }, { 1, 1 } }, { 4, 6 }, { 1, 1 }, { ConstraintType::LessEqual, ConstraintType::GreaterEqual }, mode);
+        CHECK(!infeasible.SolveDual(solve, false));
+        CHECK(infeasible.GetStatus() == SolveStatus::Infeasible);
+    }
+
+    SimplexSolve solve;
+
+    // max x1 + x2: x1 - x2 = 1
+    Simplex unbounded({ { 1, -1 } }, { 1 }, { 1, 1 }, { ConstraintType::Equal }, SimplexMode::Max);
+    CHECK(!unbounded.SolveDual(solve, false));
+    CHECK(unbounded.GetStatus() == SolveStatus::Unbounded);
+
+    // min -x1: x1 >= 1
+    Simplex unboundedMin({ { 1 } }, { 1 }, { -1 }, { ConstraintType::GreaterEqual }, SimplexMode::Min);
+    CHECK(!unboundedMin.SolveDual(solve, false));
+    CHECK(unboundedMin.GetStatus() == SolveStatus::Unbounded);
+}
+
+// широкое покрытие (много строк >=, мало переменных) решается через двойственную,
+// высокая упаковка (мало строк <=, много переменных) - прямой задачей
+void TestChoice() {
+    vector<vector<Fraqtion>> cover(40, vector<Fraqtion>(6)), pack(6, vector<Fraqtion>(40));
+
+    for (int i = 0; i < 40; i++)
+        for (int j = 0; j < 6; j++)
+            cover[i][j] = pack[j][i] = (i + 2 * j) % 4 + 1;
+
+    Simplex covering(cover, vector<Fraqtion>(40, 10), vector<Fraqtion>(6, 1), vector<ConstraintType>(40, ConstraintType::GreaterEqual), SimplexMode::Min);
+    Simplex packing(pack, vector<Fraqtion>(6, 10), vector<Fraqtion>(40, 1), vector<ConstraintType>(6, ConstraintType::LessEqual), SimplexMode::Max);
+
+    CHECK(covering.ChooseFormulation() == Formulation::Dual);
+    CHECK(packing.ChooseFormulation() == Formulation::Primal);
+    CHECK(covering.EstimateFormulation(Formulation::Primal).artificials == 40);
+    CHECK(covering.EstimateFormulation(Formulation::Dual).artificials == 0);
+
+    CoutCapture capture;
+    SimplexSolve solve;
+    CHECK(covering.SolveAuto(solve, true));
+    CHECK(capture.Text().find("Solving dual task") != string::npos);
+}
+
+int main() {
+    TestAgreement();
+    TestStatuses();
+    TestChoice();
+
+    return CheckResult("DualTest");
+}
@@ -0,0 +1,98 @@
+// сборка: g++ -std=c++17 -O2 tests/FixedSimplexTest.cpp -o FixedSimplexTest
+#include "../simplex.hpp"
+#include "../FixedSimplex.hpp"
+#include "Check.hpp"
+
+// демонстрационная задача main.cpp решается на этапе компиляции
+constexpr FixedSimplex<3, 3> SolvedDemo() {
+    FixedSimplex<3, 3> simplex({ { { 4, 1, 1 }, { 1, 2, 0 }, { 0, Fraqtion(1, 2), 1 } } }, { 4, 3, 2 }, { 7, 5, 3 }, SimplexMode::Max);
+    simplex.Solve();
+
+    return simplex;
+}
+
+static_assert(SolvedDemo().GetF() == 13 && SolvedDemo().GetIterations() == 3, "demo is solved at compile time like Simplex");
+
+// совпадение с Simplex по результату, значению функции, точке и числу итераций
+void TestAgreement() {
+    TaskShape shape;
+    shape.low = -1;
+    shape.high = 7;
+    shape.rhsLow = 5;
+    shape.rhsHigh = 44;
+    shape.costLow = -4;
+    shape.costHigh = 8;
+
+    for (int seed = 0; seed < 500; seed++) {
+        shape.mode = seed % 2 ? SimplexMode::Min : SimplexMode::Max;
+        LpTask task = RandomTask(seed, 5, 4, shape);
+
+        Simplex simplex = task.Build();
+        FixedSimplex<5, 4> fixed = BuildFixed<5, 4>(task);
+
+        bool result = simplex.Solve(false);
+        CHECK(fixed.Solve() == result);
+
+        if (!result)
+            continue;
+
+        SimplexSolve solve = simplex.GetSolve();
+        array<Fraqtion, 5> x = fixed.GetX();
+
+        CHECK(fixed.GetF() == solve.f);
+        CHECK(fixed.GetIterations() == simplex.GetIterations());
+
+        for (int j = 0; j < 5; j++)
+            CHECK(x[j] == solve.x[j]);
+    }
+}
+
+// отрицательная правая часть (нужна первая фаза) и неограниченная функция - отказ
+void TestRejected() {
+    FixedSimplex<2, 1> negative({ { { 1, 1 } } }, { -1 }, { 1, 1 }, SimplexMode::Max);
+    CHECK(!negative.Solve());
+
+    FixedSimplex<2, 1> unbounded({ { { 1, -1 } } }, { 1 }, { 1, 1 }, SimplexMode::Max);
+    CHECK(!unbounded.Solve());
+}
+
+// переполнение дробей - отказ, как у Simplex, а не план из заменённых нулями значений
+void TestOverflow() {
+    int overflow = 0;
+
+    for (int seed = 0; seed < 50; seed++) {
+        LpTask task = RandomTask(seed, 6, 6, IllConditionedShape(seed % 2 ? 97 : 1)); // нечётные - с крупными знаменателями
+
+        Fraqtion::overflow = true; // флаг от предыдущих вычислений не влияет на решение
+        FixedSimplex<6, 6> fixed = BuildFixed<6, 6>(task);
+        bool result = fixed.Solve();
+
+        CHECK(result == !Fraqtion::overflow);
+
+        if (!result) {
+            overflow++;
+            continue;
+        }
+
+        array<Fraqtion, 6> x = fixed.GetX();
+
+        for (int i = 0; i < 6; i++) {
+            Fraqtion sum = 0;
+
+            for (int j = 0; j < 6; j++)
+                sum += task.a[i][j] * x[j];
+
+            CHECK(sum <= task.b[i]);
+        }
+    }
+
+    CHECK(overflow > 0 && overflow < 50);
+}
+
+int main() {
+    TestAgreement();
+    TestRejected();
+    TestOverflow();
+
+    return CheckResult("FixedSimplexTest");
+}
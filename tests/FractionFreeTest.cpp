@@ -0,0 +1,153 @@
+// сборка: g++ -std=c++17 -O2 tests/FractionFreeTest.cpp -o FractionFreeTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+// выполняются ли ограничения и равно ли значение функции c·x (в long double, чтобы не зависеть от дробей)
+bool Satisfies(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const vector<Fraqtion> &c, const vector<ConstraintType> &types, const SimplexSolve &solve) {
+    long double f = 0;
+
+    for (int j = 0; j < c.size(); j++) {
+        if (solve.x[j] < 0)
+            return false;
+
+        f += (long double) c[j].ToDouble() * solve.x[j].ToDouble();
+    }
+
+    for (int i = 0; i < a.size(); i++) {
+        long double sum = 0;
+
+        for (int j = 0; j < c.size(); j++)
+            sum += (long double) a[i][j].ToDouble() * solve.x[j].ToDouble();
+
+        if (types[i] == ConstraintType::LessEqual ? sum > b[i].ToDouble() + 1e-9 : sum < b[i].ToDouble() - 1e-9)
+            return false;
+    }
+
+    return fabsl(f - solve.f.ToDouble()) <= 1e-9 * (1 + fabsl(f));
+}
+
+// целочисленная таблица даёт тот же результат, что и дробная, и не хуже неё по диапазону
+void TestRandom() {
+    int compared = 0, rescued = 0;
+
+    for (int size = 4; size <= 10; size += 2) {
+        for (int seed = 0; seed < 100; seed++) {
+            LpTask task = RandomTask(seed, size, size, FractionalShape(size / 2));
+
+            Simplex rational = task.Build();
+            Simplex fractionFree = task.Build();
+
+            bool rationalResult = rational.Solve(false);
+            bool fractionFreeResult = fractionFree.Solve(false, CrashMode::Slack, true);
+
+            if (fractionFreeResult)
+                CHECK(Satisfies(task.a, task.b, task.c, task.types, fractionFree.GetSolve()));
+
+            if (rational.GetStatus() == SolveStatus::Overflow) {
+                rescued += fractionFree.GetStatus() != SolveStatus::Overflow;
+                continue;
+            }
+
+            compared++;
+            CHECK(fractionFree.GetStatus() == rational.GetStatus());
+            CHECK(fractionFree.GetIterations() == rational.GetIterations());
+
+            if (rationalResult && fractionFreeResult)
+                CHECK(fractionFree.GetSolve().f == rational.GetSolve().f);
+        }
+    }
+
+    CHECK(compared > 100);
+    CHECK(rescued > 0); // в long long с определителем базиса помещаются задачи, на которых дроби переполняются
+}
+
+// произведение знаменателей строк не помещается в long long - решение продолжается в дробях с тем же ответом
+void TestFallback() {
+    int primes[] = { 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051 };
+    vector<vector<Fraqtion>> a(3, vector<Fraqtion>(3));
+
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            a[i][j] = Fraqtion(1, primes[i * 3 + j]);
+
+    vector<ConstraintType> types(3, ConstraintType::LessEqual);
+    Simplex rational(a, { 1, 1, 1 }, { 1, 2, 3 }, types, SimplexMode::Max);
+    Simplex fractionFree(a, { 1, 1, 1 }, { 1, 2, 3 }, types, SimplexMode::Max);
+
+    CHECK(rational.Solve(false));
+
+    {
+        CoutCapture capture;
+        CHECK(fractionFree.Solve(true, CrashMode::Slack, true));
+        CHECK(capture.Text().find("continue with fractions") != string::npos);
+    }
+
+    CHECK(fractionFree.GetStatus() == SolveStatus::Optimal);
+    CHECK(fractionFree.GetSolve().f == rational.GetSolve().f);
+    CHECK(fractionFree.GetIterations() == rational.GetIterations());
+}
+
+// целочисленные задачи с первой фазой: цепочка ведущих элементов продолжается во второй фазе,
+// все деления точны и решение ни разу не уходит в дроби; точка совпадает с дробной таблицей
+void TestIntegerChain() {
+    for (int seed = 0; seed < 200; seed++) {
+        srand(seed);
+        int size = seed % 5 + 4;
+        vector<vector<Fraqtion>> a(size, vector<Fraqtion>(size));
+        vector<Fraqtion> b(size), c(size);
+        vector<ConstraintType> types(size);
+
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++)
+                a[i][j] = rand() % 7;
+
+            b[i] = rand() % 20 + 1;
+            types[i] = i == 0 ? ConstraintType::LessEqual : (ConstraintType) (rand() % 3);
+        }
+
+        for (int j = 0; j < size; j++)
+            c[j] = rand() % 9 - 2;
+
+        a[0] = vector<Fraqtion>(size, 1); // бюджет: задача ограничена
+
+        Simplex rational(a, b, c, types, SimplexMode::Max);
+        Simplex fractionFree(a, b, c, types, SimplexMode::Max);
+
+        bool result = rational.Solve(false);
+        CoutCapture capture;
+        CHECK(fractionFree.Solve(true, CrashMode::Slack, true) == result);
+        CHECK(capture.Text().find("continue with fractions") == string::npos);
+        CHECK(fractionFree.GetStatus() == rational.GetStatus());
+        CHECK(fractionFree.GetIterations() == rational.GetIterations());
+
+        if (result)
+            CHECK(fractionFree.GetSolve().x == rational.GetSolve().x);
+    }
+}
+
+// на небольших задачах отладочный вывод обоих путей совпадает посимвольно
+void TestTrace() {
+    vector<vector<Fraqtion>> a = { { 1, 1, 1 }, { 1, 0, 0 }, { 0, 1, 0 }, { 1, 0, 0 }, { 0, 0, 1 } };
+    vector<ConstraintType> types = { ConstraintType::Equal, ConstraintType::GreaterEqual, ConstraintType::GreaterEqual, ConstraintType::LessEqual, ConstraintType::GreaterEqual };
+    string traces[2];
+
+    for (int fractionFree = 0; fractionFree < 2; fractionFree++) {
+        CoutCapture capture;
+        Simplex minimum(a, { 6, 1, 1, 3, 1 }, { 2, 3, 1 }, types, SimplexMode::Min);
+        Simplex maximum({ { 4, 1, 1 }, { 1, 2, 0 }, { 0, Fraqtion(1, 2), 1 } }, { 4, 3, 2 }, { 7, 5, 3 }, SimplexMode::Max);
+
+        CHECK(minimum.Solve(true, CrashMode::Slack, fractionFree));
+        CHECK(maximum.Solve(true, CrashMode::Slack, fractionFree));
+        traces[fractionFree] = capture.Text();
+    }
+
+    CHECK(traces[0] == traces[1]);
+}
+
+int main() {
+    TestRandom();
+    TestFallback();
+    TestIntegerChain();
+    TestTrace();
+    return CheckResult("FractionFreeTest");
+}
@@ -0,0 +1,128 @@
+// сборка: g++ -std=c++17 -O2 tests/HeuristicsTest.cpp -o HeuristicsTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+const string BRANCHING_PATH = TempPath("heuristics_test.bin");
+
+// небольшие задачи max c·x, a·x <= b в целых неотрицательных числах
+struct Task {
+    vector<vector<Fraqtion>> a;
+    vector<Fraqtion> b, c;
+};
+
+vector<Task> Tasks() {
+    return {
+        { { { 3, 2, 5, 4 }, { Fraqtion(7, 2), 4, 1, 3 }, { 2, 5, 3, Fraqtion(5, 3) } }, { 17, 19, 16 }, { 7, 6, 9, 8 } },
+        { { { 5, 7, 4 }, { 3, 2, 6 } }, { 23, 19 }, { 8, 9, 7 } },
+        { { { 2, 3, 1, 4, 2 }, { 3, 1, 4, 2, 5 }, { 1, 4, 2, 3, 1 } }, { 13, 15, 12 }, { 5, 6, 4, 7, 5 } }
+    };
+}
+
+// поиск с заданными эвристиками, вывод собирается для проверки отчёта о первом решении
+BranchingState Search(const Task &task, bool heuristics, int frequency, string &text) {
+    BranchingState state;
+    state.heuristics = heuristics;
+    state.heuristicFrequency = frequency;
+
+    CoutCapture capture;
+    Simplex simplex(task.a, task.b, task.c, SimplexMode::Max);
+    simplex.SolveIntegerBranchesAndBorders(state, false);
+    text = capture.Text();
+
+    return state;
+}
+
+// рекорд - целая допустимая точка со значением incumbent
+void CheckIncumbent(const Task &task, const BranchingState &state) {
+    CHECK(state.hasIncumbent);
+    CHECK(state.incumbentX.size() == task.c.size());
+
+    Fraqtion f = 0;
+
+    for (int j = 0; j < task.c.size(); j++) {
+        CHECK(state.incumbentX[j].IsInteger() && state.incumbentX[j] >= 0);
+        f += task.c[j] * state.incumbentX[j];
+    }
+
+    for (int i = 0; i < task.a.size(); i++) {
+        Fraqtion sum = 0;
+
+        for (int j = 0; j < task.c.size(); j++)
+            sum += task.a[i][j] * state.incumbentX[j];
+
+        CHECK(sum <= task.b[i]);
+    }
+
+    CHECK(f == state.incumbent);
+}
+
+// эвристики не меняют оптимум, а решение, найденное ими, допустимо
+void TestSameOptimum() {
+    int heuristicFirst = 0;
+
+    for (const Task &task : Tasks()) {
+        string text;
+        BranchingState plain = Search(task, false, 10, text);
+        CheckIncumbent(task, plain);
+
+        for (int frequency : { 1, 3, 10 }) {
+            BranchingState state = Search(task, true, frequency, text);
+            CheckIncumbent(task, state);
+            CHECK(state.incumbent == plain.incumbent);
+
+            // отчёт о первом решении: узел, время и источник
+            CHECK(!state.firstIncumbentSource.empty());
+            CHECK(state.firstIncumbentNode >= 1 && state.firstIncumbentNode <= state.nodes);
+            CHECK(state.firstIncumbentSeconds >= 0);
+            CHECK(text.find("First incumbent: node " + to_string(state.firstIncumbentNode)) != string::npos);
+            CHECK(text.find("(" + state.firstIncumbentSource + ")") != string::npos);
+
+            heuristicFirst += state.firstIncumbentSource != "LP";
+        }
+    }
+
+    CHECK(heuristicFirst > 0); // хотя бы раз первое решение дала эвристика, а не LP узла
+}
+
+// нулевой и отрицательный период - эвристики только в корне, без деления на ноль
+void TestRootOnly() {
+    for (const Task &task : Tasks()) {
+        string text;
+        BranchingState plain = Search(task, false, 10, text);
+
+        for (int frequency : { 0, -5 }) {
+            BranchingState state = Search(task, true, frequency, text);
+            CheckIncumbent(task, state);
+            CHECK(state.incumbent == plain.incumbent);
+        }
+    }
+
+    // в снимок поиска такой период записывается как 0 и загружается обратно
+    BranchingState state;
+    state.heuristics = true;
+    state.heuristicFrequency = -5;
+    state.pauseNodes = 2;
+
+    CoutCapture capture;
+    Task task = Tasks()[0];
+    Simplex simplex(task.a, task.b, task.c, SimplexMode::Max);
+    simplex.SolveIntegerBranchesAndBorders(state, false);
+    CHECK(simplex.SaveBranching(BRANCHING_PATH, state));
+
+    BranchingState loaded;
+    Simplex other({ { 1 } }, { 1 }, { 1 }, SimplexMode::Min);
+    CHECK(other.LoadBranching(BRANCHING_PATH, loaded));
+    CHECK(loaded.heuristicFrequency == 0);
+
+    other.SolveIntegerBranchesAndBorders(loaded, false);
+    CHECK(loaded.incumbent == 37);
+
+    remove(BRANCHING_PATH.c_str());
+}
+
+int main() {
+    TestSameOptimum();
+    TestRootOnly();
+
+    return CheckResult("HeuristicsTest");
+}
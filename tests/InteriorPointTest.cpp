@@ -0,0 +1,59 @@
+// сборка: g++ -std=c++17 -O2 tests/InteriorPointTest.cpp -o InteriorPointTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+// значение функции метода внутренней точки близко к точному оптимуму (оно не переполняется на суммировании)
+void TestObjective() {
+    for (int seed = 0; seed < 50; seed++) {
+        Simplex exact = RandomTask(seed, 8, 6).Build();
+        Simplex ipm = RandomTask(seed, 8, 6).Build();
+
+        CHECK(exact.Solve(false));
+        SimplexSolve solve = ipm.SolveInteriorPoint(false);
+        double f = exact.GetSolve().f.ToDouble();
+
+        CHECK(ipm.GetStatus() == SolveStatus::Optimal);
+        CHECK(ipm.GetIterations() > 0);
+        CHECK(solve.x.size() == 14);
+        CHECK(fabs(solve.f.ToDouble() - f) <= 1e-6 * fabs(f));
+    }
+}
+
+// несовместная и неограниченная задачи: метод не сходится, состояние IterationLimit, функция 0
+void TestNotConverged() {
+    Simplex infeasible({ { 1 }, { 1 } }, { 5, 2 }, { 1 }, { ConstraintType::GreaterEqual, ConstraintType::LessEqual }, SimplexMode::Max);
+    SimplexSolve solve = infeasible.SolveInteriorPoint(false);
+    CHECK(infeasible.GetStatus() == SolveStatus::IterationLimit);
+    CHECK(solve.f == 0 && solve.x.empty());
+
+    Simplex unbounded({ { 1, -1 } }, { 1 }, { 1, 1 }, { ConstraintType::LessEqual }, SimplexMode::Max);
+    solve = unbounded.SolveInteriorPoint(false);
+    CHECK(unbounded.GetStatus() == SolveStatus::IterationLimit);
+    CHECK(solve.f == 0 && solve.x.empty());
+}
+
+// crossover из точки метода внутренней точки приходит к тому же оптимуму за меньшее число итераций
+void TestCrossover() {
+    int slackIterations = 0, crossoverIterations = 0;
+
+    for (int seed = 0; seed < 50; seed++) {
+        Simplex slack = RandomTask(seed, 8, 6).Build();
+        Simplex crossover = RandomTask(seed, 8, 6).Build();
+
+        CHECK(slack.Solve(false));
+        CHECK(crossover.Solve(false, CrashMode::InteriorPoint));
+        CHECK(crossover.GetSolve().f == slack.GetSolve().f);
+
+        slackIterations += slack.GetIterations();
+        crossoverIterations += crossover.GetIterations();
+    }
+
+    CHECK(crossoverIterations < slackIterations);
+}
+
+int main() {
+    TestObjective();
+    TestNotConverged();
+    TestCrossover();
+    return CheckResult("InteriorPointTest");
+}
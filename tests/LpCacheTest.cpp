@@ -0,0 +1,184 @@
+// сборка: g++ -std=c++17 -O2 tests/LpCacheTest.cpp -o LpCacheTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+const string CACHE_PATH = TempPath("lp_cache_test.bin"), BAD_PATH = TempPath("lp_cache_bad.bin"); // сохранённый и испорченный кэш
+
+// max 3x1 + 2x2 + 4x3: три ограничения, оптимум требует нескольких итераций
+Simplex Task() {
+    return Simplex({ { 1, 1, 2 }, { 2, 0, 3 }, { 2, 1, 3 } }, { 4, 5, 7 }, { 3, 2, 4 }, vector<ConstraintType>(3, ConstraintType::LessEqual), SimplexMode::Max);
+}
+
+// прерванное решение не попадает в кэш, следующее полное решение запоминается
+void TestLimits() {
+    LpCache cache;
+    atomic<bool> cancel(true);
+
+    Simplex limited = Task();
+    limited.SetLimits(1, 0);
+    CHECK(!limited.SolveCached(cache));
+    CHECK(limited.GetStatus() == SolveStatus::IterationLimit);
+    CHECK(cache.Size() == 0);
+
+    Simplex cancelled = Task();
+    cancelled.SetLimits(0, 0, &cancel);
+    CHECK(!cancelled.SolveCached(cache));
+    CHECK(cancelled.GetStatus() == SolveStatus::Cancelled);
+    CHECK(cache.Size() == 0);
+
+    Simplex full = Task();
+    CHECK(full.SolveCached(cache));
+    CHECK(cache.Size() == 1);
+
+    Simplex hit = Task();
+    CHECK(hit.SolveCached(cache));
+    CHECK(hit.GetStatus() == SolveStatus::Optimal);
+    CHECK(hit.GetSolve().f == full.GetSolve().f);
+    CHECK(cache.GetHits() == 1);
+}
+
+// неограниченная задача не кэшируется, несовместная кэшируется и восстанавливается с состоянием
+void TestStatuses() {
+    LpCache cache;
+
+    // max x1 + x2: x1 - x2 <= 1
+    Simplex unbounded({ { 1, -1 } }, { 1 }, { 1, 1 }, { ConstraintType::LessEqual }, SimplexMode::Max);
+    CHECK(!unbounded.SolveCached(cache));
+    CHECK(unbounded.GetStatus() == SolveStatus::Unbounded);
+    CHECK(cache.Size() == 0);
+
+    // x1 >= 5, x1 <= 2
+    Simplex infeasible({ { 1 }, { 1 } }, { 5, 2 }, { 1 }, { ConstraintType::GreaterEqual, ConstraintType::LessEqual }, SimplexMode::Max);
+    CHECK(!infeasible.SolveCached(cache));
+    CHECK(cache.Size() == 1);
+
+    Simplex again({ { 1 }, { 1 } }, { 5, 2 }, { 1 }, { ConstraintType::GreaterEqual, ConstraintType::LessEqual }, SimplexMode::Max);
+    CHECK(!again.SolveCached(cache));
+    CHECK(again.GetStatus() == SolveStatus::Infeasible);
+    CHECK(again.GetIterations() == 0);
+    CHECK(cache.GetHits() == 1);
+}
+
+// попаданием считается только та же задача: другая правая часть или функция - промах
+void TestContent() {
+    LpCache cache;
+
+    Simplex first = Task();
+    CHECK(first.SolveCached(cache));
+
+    Simplex otherB({ { 1, 1, 2 }, { 2, 0, 3 }, { 2, 1, 3 } }, { 4, 5, 8 }, { 3, 2, 4 }, vector<ConstraintType>(3, ConstraintType::LessEqual), SimplexMode::Max);
+    CHECK(otherB.SolveCached(cache));
+
+    Simplex otherMode({ { 1, 1, 2 }, { 2, 0, 3 }, { 2, 1, 3 } }, { 4, 5, 7 }, { 3, 2, 4 }, vector<ConstraintType>(3, ConstraintType::LessEqual), SimplexMode::Min);
+    CHECK(otherMode.SolveCached(cache));
+
+    CHECK(cache.GetHits() == 0);
+    CHECK(cache.Size() == 3);
+
+    // та же задача с переставленными строками - попадание
+    Simplex permuted({ { 2, 1, 3 }, { 1, 1, 2 }, { 2, 0, 3 } }, { 7, 4, 5 }, { 3, 2, 4 }, vector<ConstraintType>(3, ConstraintType::LessEqual), SimplexMode::Max);
+    CHECK(permuted.SolveCached(cache));
+    CHECK(cache.GetHits() == 1);
+    CHECK(permuted.GetSolve().f == first.GetSolve().f);
+}
+
+// запись числа в файл по смещению
+void Patch(const string &path, long offset, int32_t value) {
+    fstream file(path, ios::binary | ios::in | ios::out);
+    file.seekp(offset);
+    file.write((const char *) &value, sizeof(value));
+}
+
+// сохранённый кэш загружается и даёт попадание; испорченный файл не загружается и кэш не меняет
+void TestPersistence() {
+    LpCache saved;
+    Simplex solved = Task();
+    CHECK(solved.SolveCached(saved));
+    CHECK(saved.Save(CACHE_PATH));
+    CHECK(!ifstream(CACHE_PATH + ".tmp"));
+
+    LpCache loaded;
+    CHECK(loaded.Load(CACHE_PATH));
+    CHECK(loaded.Size() == 1);
+
+    Simplex hit = Task();
+    CHECK(hit.SolveCached(loaded));
+    CHECK(loaded.GetHits() == 1);
+    CHECK(hit.GetSolve().f == solved.GetSolve().f);
+
+    ifstream in(CACHE_PATH, ios::binary);
+    string bytes((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    in.close();
+
+    // заголовок 12 байт, запись: размер задачи (36 слов для n = 3 и трёх строк), задача,
+    // допустимость, функция, размер базиса и базис
+    long entry = 12, basis = entry + 4 + 36 * 4 + 4 * 4;
+
+    vector<pair<string, function<void(const string &)>>> corruptions = {
+        { "magic", [](const string &path) { Patch(path, 0, 0); } },
+        { "version", [](const string &path) { Patch(path, 4, 1); } },
+        { "count", [](const string &path) { Patch(path, 8, LP_CACHE_ENTRY_LIMIT + 1); } },
+        { "problem size", [&](const string &path) { Patch(path, entry, 1 << 30); } },
+        { "problem shape", [&](const string &path) { Patch(path, entry + 4, 4); } },
+        { "denominator", [&](const string &path) { Patch(path, entry + 4 + 4 * 4, 0); } },
+        { "feasible", [&](const string &path) { Patch(path, basis - 16, 2); } },
+        { "basis size", [&](const string &path) { Patch(path, basis - 4, 1 << 30); } },
+        { "basis index", [&](const string &path) { Patch(path, basis, 6); } },
+        { "negative index", [&](const string &path) { Patch(path, basis + 4, -1); } },
+        { "truncated", [&](const string &path) { ofstream(path, ios::binary).write(bytes.data(), bytes.size() - 3); } },
+        { "trailing", [&](const string &path) { ofstream(path, ios::binary | ios::app).write("x", 1); } }
+    };
+
+    for (auto &corruption : corruptions) {
+        ofstream(BAD_PATH, ios::binary).write(bytes.data(), bytes.size());
+        corruption.second(BAD_PATH);
+
+        LpCache cache;
+        Simplex other({ { 1 } }, { 1 }, { 1 }, SimplexMode::Max);
+        CHECK(other.SolveCached(cache));
+
+        if (cache.Load(BAD_PATH))
+            cerr << "corruption accepted: " << corruption.first << endl;
+
+        CHECK(cache.Size() == 1);
+    }
+
+    remove(CACHE_PATH.c_str());
+    remove(BAD_PATH.c_str());
+}
+
+// отменённые ветви и границы не отравляют кэш и отмечают поиск неполным
+void TestBranchesAndBorders() {
+    CoutCapture capture;
+    LpCache cache;
+    atomic<bool> cancel(true);
+    BranchingState state;
+    state.cache = &cache;
+
+    Simplex simplex = Task();
+    simplex.SetLimits(0, 0, &cancel);
+    CHECK(simplex.SolveIntegerBranchesAndBorders(state, false).empty());
+    CHECK(state.stoppedNodes == 1);
+    CHECK(state.stopStatus == SolveStatus::Cancelled);
+    CHECK(cache.Size() == 0);
+    CHECK(capture.Text().find("Solve cancelled") != string::npos);
+
+    cancel = false;
+    BranchingState complete;
+    complete.cache = &cache;
+
+    Simplex again = Task();
+    again.SetLimits(0, 0, &cancel);
+    CHECK(!again.SolveIntegerBranchesAndBorders(complete, false).empty());
+    CHECK(complete.stoppedNodes == 0);
+    CHECK(cache.Size() > 0);
+}
+
+int main() {
+    TestLimits();
+    TestStatuses();
+    TestContent();
+    TestPersistence();
+    TestBranchesAndBorders();
+    return CheckResult("LpCacheTest");
+}
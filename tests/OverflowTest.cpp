@@ -0,0 +1,144 @@
+// сборка: g++ -std=c++17 -O2 -pthread tests/OverflowTest.cpp -o OverflowTest
+#include "../SolverService.hpp"
+#include "Check.hpp"
+
+// задача IllConditionedShape по векторам условий
+void IllConditioned(int seed, int n, int m, vector<vector<Fraqtion>> &a, vector<Fraqtion> &b, vector<Fraqtion> &c) {
+    LpTask task = RandomTask(seed, n, m, IllConditionedShape());
+    a = task.a;
+    b = task.b;
+    c = task.c;
+}
+
+// выполняются ли ограничения a·x <= b и x >= 0
+bool Satisfies(const vector<vector<Fraqtion>> &a, const vector<Fraqtion> &b, const vector<Fraqtion> &x) {
+    for (int j = 0; j < x.size(); j++)
+        if (x[j] < 0)
+            return false;
+
+    for (int i = 0; i < a.size(); i++) {
+        Fraqtion sum = 0;
+
+        for (int j = 0; j < x.size(); j++)
+            sum += a[i][j] * x[j];
+
+        if (sum > b[i])
+            return false;
+    }
+
+    return true;
+}
+
+// Solve либо находит план без переполнения, либо сообщает Overflow и не даёт решения
+void TestSolve() {
+    int optimal = 0, overflow = 0;
+
+    for (int seed = 0; seed < 100; seed++) {
+        vector<vector<Fraqtion>> a;
+        vector<Fraqtion> b, c;
+        IllConditioned(seed, 6, 6, a, b, c);
+
+        Simplex simplex(a, b, c, vector<ConstraintType>(6, ConstraintType::LessEqual), SimplexMode::Max);
+        bool result = simplex.Solve(false);
+
+        if (result) {
+            optimal++;
+            CHECK(simplex.GetStatus() == SolveStatus::Optimal);
+            CHECK(!Fraqtion::overflow);
+
+            SimplexSolve solve = simplex.GetSolve();
+            CHECK(Satisfies(a, b, vector<Fraqtion>(solve.x.begin(), solve.x.begin() + 6)));
+        }
+        else {
+            CHECK(simplex.GetStatus() == SolveStatus::Overflow);
+            overflow++;
+        }
+    }
+
+    CHECK(optimal > 0);
+    CHECK(overflow > 0);
+}
+
+// флаг, оставшийся от прошлых вычислений, не мешает следующему решению
+void TestFlagReset() {
+    Fraqtion::overflow = true;
+
+    Simplex simplex({ { 1, 1 }, { 1, 3 } }, { 4, 6 }, { 3, 2 }, { ConstraintType::LessEqual, ConstraintType::LessEqual }, SimplexMode::Max);
+    CHECK(simplex.Solve(false));
+    CHECK(simplex.GetStatus() == SolveStatus::Optimal);
+    CHECK(simplex.GetSolve().f == 12);
+}
+
+// двойственная формулировка при переполнении переходит к прямой и не сообщает ложный успех
+void TestDual() {
+    for (int seed = 0; seed < 30; seed++) {
+        vector<vector<Fraqtion>> a;
+        vector<Fraqtion> b, c;
+        IllConditioned(seed, 6, 6, a, b, c);
+        vector<ConstraintType> types(6, ConstraintType::LessEqual);
+
+        Simplex primal(a, b, c, types, SimplexMode::Max);
+        Simplex dual(a, b, c, types, SimplexMode::Max);
+        SimplexSolve solve;
+
+        bool primalResult = primal.Solve(false);
+        bool dualResult = dual.SolveDual(solve, false);
+
+        if (dualResult) {
+            CHECK(dual.GetStatus() == SolveStatus::Optimal);
+            CHECK(Satisfies(a, b, vector<Fraqtion>(solve.x.begin(), solve.x.begin() + 6)));
+
+            if (primalResult)
+                CHECK(solve.f == primal.GetSolve().f);
+        }
+        else {
+            CHECK(dual.GetStatus() == SolveStatus::Overflow);
+        }
+    }
+}
+
+// ветви и границы считают прерванные узлы и не выдают поиск за полный
+void TestBranchesAndBorders() {
+    int seed = 0;
+    vector<vector<Fraqtion>> a;
+    vector<Fraqtion> b, c;
+
+    do {
+        IllConditioned(seed++, 6, 6, a, b, c);
+    } while (Simplex(a, b, c, vector<ConstraintType>(6, ConstraintType::LessEqual), SimplexMode::Max).Solve(false));
+
+    CoutCapture capture;
+    Simplex simplex(a, b, c, vector<ConstraintType>(6, ConstraintType::LessEqual), SimplexMode::Max);
+    BranchingState state;
+
+    CHECK(simplex.SolveIntegerBranchesAndBorders(state, false).empty());
+    CHECK(state.stoppedNodes == 1);
+    CHECK(state.stopStatus == SolveStatus::Overflow);
+    CHECK(capture.Text().find("fraction overflow") != string::npos);
+}
+
+// сервис возвращает состояние Overflow и пустое решение
+void TestService() {
+    shared_ptr<ServiceJob> job = make_shared<ServiceJob>();
+    int seed = 0;
+
+    do {
+        IllConditioned(seed++, 6, 6, job->a, job->b, job->c);
+    } while (Simplex(job->a, job->b, job->c, vector<ConstraintType>(6, ConstraintType::LessEqual), SimplexMode::Max).Solve(false));
+
+    job->types = vector<ConstraintType>(6, ConstraintType::LessEqual);
+
+    SolverService service(1);
+    shared_ptr<ServiceJob> result = service.Wait(service.Submit(job));
+    CHECK(result->status == SolveStatus::Overflow);
+    CHECK(result->solve.f == 0 && result->solve.x.empty());
+}
+
+int main() {
+    TestSolve();
+    TestFlagReset();
+    TestDual();
+    TestBranchesAndBorders();
+    TestService();
+    return CheckResult("OverflowTest");
+}
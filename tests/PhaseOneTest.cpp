@@ -0,0 +1,84 @@
+// сборка: g++ -std=c++17 -O2 tests/PhaseOneTest.cpp -o PhaseOneTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+const string BASIS_PATH = TempPath("phase_one_basis.txt");
+
+// ограничения <=, >= и = решаются напрямую, без перестановки знаков строк
+void TestConstraintTypes() {
+    // max 2x1 + 3x2: x1 + x2 <= 4, x1 + 3x2 >= 6, x1 - x2 = 0 -> x1 = x2 = 2
+    Simplex mixed({ { 1, 1 }, { 1, 3 }, { 1, -1 } }, { 4, 6, 0 }, { 2, 3 }, { ConstraintType::LessEqual, ConstraintType::GreaterEqual, ConstraintType::Equal }, SimplexMode::Max);
+    CHECK(mixed.Solve(false));
+    CHECK(mixed.GetStatus() == SolveStatus::Optimal);
+    CHECK(mixed.GetSolve().f == 10);
+    CHECK(mixed.GetSolve().x[0] == 2 && mixed.GetSolve().x[1] == 2);
+
+    // min x1 + x2: x1 + 2x2 >= 4, 3x1 + x2 >= 6 -> x1 = 8/5, x2 = 6/5
+    Simplex covering({ { 1, 2 }, { 3, 1 } }, { 4, 6 }, { 1, 1 }, { ConstraintType::GreaterEqual, ConstraintType::GreaterEqual }, SimplexMode::Min);
+    CHECK(covering.Solve(false));
+    CHECK(covering.GetSolve().f == Fraqtion(14, 5));
+
+    // отрицательная правая часть у <=: x1 - x2 <= -2 -> x2 >= x1 + 2
+    Simplex negative({ { 1, -1 }, { 0, 1 } }, { -2, 5 }, { 1, 1 }, { ConstraintType::LessEqual, ConstraintType::LessEqual }, SimplexMode::Max);
+    CHECK(negative.Solve(false));
+    CHECK(negative.GetSolve().f == 8);
+}
+
+// несовместность доказывается функцией первой фазы; после неудачи решение, базис и повторное решение
+// не выходят за пределы таблицы
+void TestInfeasible() {
+    vector<ConstraintType> types[] = {
+        { ConstraintType::LessEqual, ConstraintType::GreaterEqual },
+        { ConstraintType::Equal, ConstraintType::GreaterEqual },
+        { ConstraintType::Equal, ConstraintType::Equal }
+    };
+
+    for (auto &rowTypes : types) {
+        // x1 + x2 ? 4, x1 + x2 ? 6
+        Simplex simplex({ { 1, 1 }, { 1, 1 } }, { 4, 6 }, { 1, 1 }, rowTypes, SimplexMode::Max);
+
+        CoutCapture capture;
+        CHECK(!simplex.Solve(true));
+        CHECK(simplex.GetStatus() == SolveStatus::Infeasible);
+        CHECK(capture.Text().find("Phase I objective: ") != string::npos);
+
+        SimplexSolve solve = simplex.GetSolve();
+        CHECK(solve.x.size() == 4);
+
+        for (int index : simplex.GetBasis())
+            CHECK(index >= 0 && index < 4);
+
+        CHECK(!simplex.Solve(false));
+        CHECK(simplex.GetStatus() == SolveStatus::Infeasible);
+        CHECK(simplex.SaveBasis(BASIS_PATH));
+    }
+
+    remove(BASIS_PATH.c_str());
+}
+
+// первая фаза, прерванная лимитом итераций, оставляет задачу пригодной для повторного решения
+void TestStoppedPhaseOne() {
+    vector<vector<Fraqtion>> a = { { 1, 1, 1 }, { 1, 2, 0 }, { 0, 1, 3 } };
+    vector<ConstraintType> types(3, ConstraintType::GreaterEqual);
+
+    Simplex reference(a, { 3, 4, 5 }, { 1, 1, 1 }, types, SimplexMode::Min);
+    CHECK(reference.Solve(false));
+
+    Simplex simplex(a, { 3, 4, 5 }, { 1, 1, 1 }, types, SimplexMode::Min);
+    simplex.SetLimits(1, 0);
+    CHECK(!simplex.Solve(false));
+    CHECK(simplex.GetStatus() == SolveStatus::IterationLimit);
+    CHECK(simplex.GetSolve().x.size() == 6);
+
+    simplex.SetLimits(0, 0);
+    CHECK(simplex.Solve(false));
+    CHECK(simplex.GetSolve().f == reference.GetSolve().f);
+}
+
+int main() {
+    TestConstraintTypes();
+    TestInfeasible();
+    TestStoppedPhaseOne();
+
+    return CheckResult("PhaseOneTest");
+}
@@ -0,0 +1,124 @@
+// сборка: g++ -std=c++17 -O2 tests/SnapshotTest.cpp -o SnapshotTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+const string SNAPSHOT_PATH = TempPath("SnapshotTest.smpx");
+
+// max 3x1 + 2x2 + 4x3: три ограничения
+Simplex Task() {
+    return Simplex({ { 1, 1, 2 }, { 2, 0, 3 }, { 2, 1, 3 } }, { 4, 5, 7 }, { 3, 2, 4 }, vector<ConstraintType>(3, ConstraintType::LessEqual), SimplexMode::Max);
+}
+
+// содержимое файла
+string ReadFile(const string &path) {
+    ifstream fin(path, ios::binary);
+    return string(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+}
+
+// запись содержимого в файл
+void WriteFile(const string &path, const string &content) {
+    ofstream fout(path, ios::binary);
+    fout << content;
+}
+
+// замена int32 по смещению
+string Patch(string content, int offset, int32_t value) {
+    content.replace(offset, sizeof(value), string((const char *) &value, sizeof(value)));
+    return content;
+}
+
+// снимок решённой задачи восстанавливается полностью, временный файл не остаётся
+void TestRoundTrip() {
+    Simplex simplex = Task();
+    CHECK(simplex.Solve(false));
+    CHECK(simplex.SaveSnapshot(SNAPSHOT_PATH));
+    CHECK(!ifstream(SNAPSHOT_PATH + ".tmp"));
+
+    Simplex loaded({ { 1 } }, { 1 }, { 1 }, SimplexMode::Min);
+    CHECK(loaded.LoadSnapshot(SNAPSHOT_PATH));
+    CHECK(loaded.GetSolve().f == simplex.GetSolve().f);
+    CHECK(loaded.GetBasis() == simplex.GetBasis());
+
+    // повторное решение загруженной задачи не требует итераций
+    CHECK(loaded.Solve(false));
+    CHECK(loaded.GetIterations() == 0);
+    CHECK(loaded.GetSolve().f == simplex.GetSolve().f);
+
+    // тёплый старт изменённой задачи по базису снимка
+    Simplex warm = Task();
+    CHECK(warm.LoadSnapshotBasis(SNAPSHOT_PATH));
+    CHECK(warm.Solve(false, CrashMode::User));
+    CHECK(warm.GetSolve().f == simplex.GetSolve().f);
+}
+
+// неудачная запись не портит прежний снимок
+void TestAtomicSave() {
+    Simplex simplex = Task();
+    CHECK(simplex.Solve(false));
+    CHECK(simplex.SaveSnapshot(SNAPSHOT_PATH));
+
+    string before = ReadFile(SNAPSHOT_PATH);
+    CHECK(!simplex.SaveSnapshot("/nonexistent-directory/snapshot.smpx"));
+
+    // снимок поверх существующего заменяется целиком
+    Simplex other = Task();
+    CHECK(other.SaveSnapshot(SNAPSHOT_PATH));
+    CHECK(ReadFile(SNAPSHOT_PATH) != before);
+    CHECK(ReadFile(SNAPSHOT_PATH).size() == before.size());
+}
+
+// испорченные снимки отвергаются, состояние задачи не меняется
+void TestCorrupted() {
+    Simplex simplex = Task();
+    CHECK(simplex.Solve(false));
+    CHECK(simplex.SaveSnapshot(SNAPSHOT_PATH));
+
+    string valid = ReadFile(SNAPSHOT_PATH);
+    int n = 3, m = 3;
+    int basisOffset = 24; // сигнатура, версия, n, m, режим, число начальных ограничений
+    int tableOffset = basisOffset + 4 * m;
+
+    // испорчены заголовок или базис - отвергается и загрузка одного базиса
+    vector<string> header = {
+        Patch(valid, 8, 2000000000), // огромное n
+        Patch(valid, 12, -1), // отрицательное m
+        Patch(Patch(valid, 8, 100000), 12, 100000), // размеры в пределах, но таблица слишком велика
+        Patch(valid, 16, 5), // неизвестный режим
+        Patch(valid, 20, SNAPSHOT_SIZE_LIMIT + 1), // слишком много начальных ограничений
+        Patch(valid, basisOffset, n + m), // номер базисного столбца вне таблицы
+        Patch(valid, basisOffset, -1),
+        Patch(Patch(valid, basisOffset, 0), basisOffset + 4, 0) // повтор в базисе
+    };
+
+    // типы ограничений записаны после таблицы, c и дельт
+    int typesOffset = tableOffset + 8 * (m * (n + m + 1) + 2 * (n + m + 1));
+
+    vector<string> content = {
+        valid.substr(0, valid.size() - 4), // обрезан
+        Patch(valid, tableOffset + 4, 0), // нулевой знаменатель
+        Patch(valid, tableOffset + 4, -3), // отрицательный знаменатель
+        Patch(valid, tableOffset, INT_MIN), // числитель INT_MIN
+        Patch(valid, typesOffset, 7) // неизвестный тип ограничения
+    };
+
+    for (int i = 0; i < header.size() + content.size(); i++) {
+        WriteFile(SNAPSHOT_PATH, i < header.size() ? header[i] : content[i - header.size()]);
+
+        Simplex target = Task();
+        CHECK(target.Solve(false));
+        vector<int> basis = target.GetBasis();
+
+        CHECK(!target.LoadSnapshot(SNAPSHOT_PATH));
+        CHECK(target.GetBasis() == basis);
+        CHECK(target.LoadSnapshotBasis(SNAPSHOT_PATH) == (i >= header.size()));
+    }
+
+    remove(SNAPSHOT_PATH.c_str());
+}
+
+int main() {
+    TestRoundTrip();
+    TestAtomicSave();
+    TestCorrupted();
+    return CheckResult("SnapshotTest");
+}
@@ -0,0 +1,214 @@
+// сборка: g++ -std=c++17 -O2 -pthread tests/SolverServiceTest.cpp -o SolverServiceTest
+#include "../SolverService.hpp"
+#include "Check.hpp"
+
+// задание пула по случайной задаче max c·x, a·x <= b с положительными коэффициентами
+shared_ptr<ServiceJob> RandomJob(int n, int m, int seed, int family) {
+    LpTask task = RandomTask(seed, n, m);
+    shared_ptr<ServiceJob> job = make_shared<ServiceJob>();
+    job->family = family;
+    job->a = task.a;
+    job->b = task.b;
+    job->c = task.c;
+    job->types = task.types;
+
+    return job;
+}
+
+// результаты пула совпадают с прямым решением, задачи семейства стартуют с сохранённого базиса
+void TestResults() {
+    CoutCapture capture;
+    SolverService service(3);
+    vector<int> ids;
+
+    for (int t = 0; t < 20; t++)
+        ids.push_back(service.Submit(RandomJob(6, 5, t, t % 2)));
+
+    int warm = 0;
+
+    for (int t = 0; t < 20; t++) {
+        shared_ptr<ServiceJob> job = service.Wait(ids[t]);
+        shared_ptr<ServiceJob> task = RandomJob(6, 5, t, -1);
+        Simplex simplex(task->a, task->b, task->c, task->types, SimplexMode::Max);
+
+        CHECK(simplex.Solve(false));
+        CHECK(job->status == SolveStatus::Optimal);
+        CHECK(job->solve.f == simplex.GetSolve().f);
+        CHECK(job->solve.x.size() == 6);
+        warm += job->warm;
+    }
+
+    CHECK(warm > 0);
+    CHECK(service.Wait(12345) == nullptr);
+    CHECK(capture.Text().empty()); // рабочие потоки ничего не печатают
+}
+
+// лимит итераций, отмена и несовместная задача: состояние в задаче, функция 0, переменных нет
+void TestFailures() {
+    CoutCapture capture;
+    SolverService service(2);
+
+    shared_ptr<ServiceJob> limited = RandomJob(30, 25, 99, -1);
+    limited->iterationLimit = 1;
+    shared_ptr<ServiceJob> result = service.Wait(service.Submit(limited));
+    CHECK(result->status == SolveStatus::IterationLimit);
+    CHECK(result->iterations == 1);
+    CHECK(result->solve.f == 0 && result->solve.x.empty());
+
+    shared_ptr<ServiceJob> cancelled = RandomJob(30, 25, 99, -1);
+    cancelled->cancel = true;
+    result = service.Wait(service.Submit(cancelled));
+    CHECK(result->status == SolveStatus::Cancelled);
+    CHECK(result->solve.f == 0 && result->solve.x.empty());
+
+    // x1 >= 5, x1 <= 2
+    shared_ptr<ServiceJob> infeasible = make_shared<ServiceJob>();
+    infeasible->a = { { 1 }, { 1 } };
+    infeasible->b = { 5, 2 };
+    infeasible->c = { 1 };
+    infeasible->types = { ConstraintType::GreaterEqual, ConstraintType::LessEqual };
+    result = service.Wait(service.Submit(infeasible));
+    CHECK(result->status == SolveStatus::Infeasible);
+    CHECK(result->solve.f == 0 && result->solve.x.empty());
+
+    CHECK(capture.Text().empty());
+}
+
+#ifndef _WIN32
+// запись чисел в сокет клиента
+void Send(int fd, const vector<int32_t> &values) {
+    CHECK(write(fd, values.data(), values.size() * sizeof(int32_t)) == values.size() * sizeof(int32_t));
+}
+
+// чтение числа из сокета клиента
+int32_t Receive(int fd) {
+    int32_t value = 0;
+    CHECK(read(fd, &value, sizeof(value)) == sizeof(value));
+    return value;
+}
+
+// соединение с запущенной службой (служба могла ещё не начать слушать сокет)
+int Connect(const string &path) {
+    int fd = -1;
+
+    for (int attempt = 0; attempt < 100 && fd < 0; attempt++) {
+        this_thread::sleep_for(chrono::milliseconds(10));
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        copy(path.begin(), path.end(), address.sun_path);
+
+        if (connect(fd, (sockaddr *) &address, sizeof(address)) < 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    CHECK(fd >= 0);
+    return fd;
+}
+
+// протокол через Unix-сокет: Submit, Wait и Shutdown
+void TestSocket() {
+    SolverService service(2);
+    string path = TempPath("SolverServiceTest.sock");
+    bool served = false;
+    thread server([&] { served = service.Serve(path); });
+
+    int fd = Connect(path);
+
+    // max 3x1 + 2x2: x1 + x2 <= 4, x1 + 3x2 <= 6 -> x = (4, 0), F = 12
+    Send(fd, { (int) ServiceCommand::Submit, -1, 0, 0, 0, 2, 2, 3, 1, 2, 1, 0, 4, 1, 1, 1, 1, 1, 0, 6, 1, 1, 1, 3, 1 });
+    int id = Receive(fd);
+    CHECK(id > 0);
+
+    Send(fd, { (int) ServiceCommand::Wait, id });
+    CHECK(Receive(fd) == 1);
+    CHECK(Receive(fd) == (int) SolveStatus::Optimal);
+    Receive(fd); // итерации
+    Receive(fd); // время
+    Receive(fd); // тёплый старт
+    CHECK(Receive(fd) == 12 && Receive(fd) == 1);
+    CHECK(Receive(fd) == 2);
+    CHECK(Receive(fd) == 4 && Receive(fd) == 1);
+    CHECK(Receive(fd) == 0 && Receive(fd) == 1);
+
+    // x1 >= 5, x1 <= 2: решения нет, функция 0/1, переменных нет
+    Send(fd, { (int) ServiceCommand::Submit, -1, 0, 0, 0, 1, 2, 1, 1, 1, 5, 1, 1, 1, 0, 2, 1, 1, 1 });
+    id = Receive(fd);
+    Send(fd, { (int) ServiceCommand::Wait, id });
+    CHECK(Receive(fd) == 1);
+    CHECK(Receive(fd) == (int) SolveStatus::Infeasible);
+    Receive(fd);
+    Receive(fd);
+    Receive(fd);
+    CHECK(Receive(fd) == 0 && Receive(fd) == 1);
+    CHECK(Receive(fd) == 0);
+
+    Send(fd, { (int) ServiceCommand::Shutdown });
+    CHECK(Receive(fd) == 1);
+    close(fd);
+    server.join();
+
+    CHECK(served);
+}
+
+// клиент, ушедший во время Wait, не останавливает службу (ответ в закрытый сокет - EPIPE, а не SIGPIPE),
+// а задача, таблица которой больше лимита, отклоняется до выделения памяти
+void TestClientGone() {
+    SolverService service(2);
+    string path = TempPath("SolverServiceTest.sock");
+    bool served = false;
+    thread server([&] { served = service.Serve(path); });
+
+    for (int attempt = 0; attempt < 3; attempt++) {
+        int fd = Connect(path);
+
+        // задача решается заметно дольше, чем клиент закрывает соединение
+        Send(fd, { (int) ServiceCommand::Submit, -1, 0, 0, 0, 40, 30 });
+
+        shared_ptr<ServiceJob> job = RandomJob(40, 30, attempt, -1);
+
+        for (int j = 0; j < 40; j++)
+            Send(fd, { job->c[j].GetN(), job->c[j].GetM() });
+
+        for (int i = 0; i < 30; i++) {
+            Send(fd, { (int) ConstraintType::LessEqual, job->b[i].GetN(), job->b[i].GetM() });
+
+            for (int j = 0; j < 40; j++)
+                Send(fd, { job->a[i][j].GetN(), job->a[i][j].GetM() });
+        }
+
+        int id = Receive(fd);
+        CHECK(id > 0);
+        Send(fd, { (int) ServiceCommand::Wait, id });
+        close(fd);
+    }
+
+    int fd = Connect(path);
+
+    // 2 x 1000: каждая размерность в пределах лимита, а таблица 1000 x 1003 - нет
+    Send(fd, { (int) ServiceCommand::Submit, -1, 0, 0, 0, 2, 1000 });
+    CHECK(Receive(fd) == -1);
+    close(fd);
+
+    fd = Connect(path);
+    Send(fd, { (int) ServiceCommand::Shutdown });
+    CHECK(Receive(fd) == 1);
+    close(fd);
+    server.join();
+
+    CHECK(served);
+}
+#endif
+
+int main() {
+    TestResults();
+    TestFailures();
+#ifndef _WIN32
+    TestSocket();
+    TestClientGone();
+#endif
+    return CheckResult("SolverServiceTest");
+}
@@ -0,0 +1,131 @@
+// сборка: g++ -std=c++17 -O2 tests/VerifiedTest.cpp -o VerifiedTest
+#include "../simplex.hpp"
+#include "Check.hpp"
+
+// задача со знакопеременными коэффициентами, в среднем четверть строк >=
+LpTask MixedSignTask(int seed) {
+    TaskShape shape;
+    shape.low = -2;
+    shape.high = 8;
+    shape.rhsLow = 1;
+    shape.rhsHigh = 40;
+    shape.greaterEqual = 4;
+
+    return RandomTask(seed, 6, 5, shape);
+}
+
+// проверенное решение совпадает с точным симплекс-методом, состояние и признак решения выставлены
+void TestAgreement() {
+    int certified = 0, optimal = 0;
+
+    for (int seed = 0; seed < 200; seed++) {
+        LpTask task = MixedSignTask(seed);
+
+        Simplex exact = task.Build();
+        Simplex verified = task.Build();
+
+        bool result = exact.Solve(false);
+        SimplexSolve solve = verified.SolveVerified(false);
+
+        CHECK(verified.GetStatus() == exact.GetStatus());
+
+        if (result) {
+            optimal++;
+            certified += solve.certified;
+            CHECK(solve.f == exact.GetSolve().f);
+            CHECK(verified.GetSolve().f == solve.f); // таблица решена и на подтверждённом пути
+        }
+        else {
+            CHECK(solve.f == 0 && solve.x.empty());
+        }
+    }
+
+    CHECK(optimal > 100);
+    CHECK(certified > 0);
+}
+
+// подтверждённый базис отдаётся без перестройки таблицы: точный симплекс, начатый с него, базис не меняет
+void TestCertifiedBasis() {
+    int checked = 0;
+
+    for (int seed = 0; seed < 50; seed++) {
+        LpTask task = MixedSignTask(seed);
+
+        Simplex verified = task.Build();
+        SimplexSolve solve = verified.SolveVerified(false);
+
+        if (!solve.certified)
+            continue;
+
+        checked++;
+        CHECK(solve.exactPivots == 0);
+        CHECK(verified.GetSolve().x == solve.x);
+        CHECK(verified.GetBasis().size() == 5);
+
+        vector<int> basis = verified.GetBasis();
+        Simplex warm = task.Build();
+        warm.SetStartBasis(basis);
+        CHECK(warm.Solve(false, CrashMode::User));
+        CHECK(warm.GetSolve().f == solve.f);
+
+        vector<int> warmBasis = warm.GetBasis();
+        sort(basis.begin(), basis.end());
+        sort(warmBasis.begin(), warmBasis.end());
+        CHECK(warmBasis == basis); // после ввода базиса в таблицу улучшающих итераций не было
+
+        CHECK(!verified.Solve(false) || verified.GetSolve().f == solve.f); // повторное точное решение сбрасывает подтверждённый ответ
+    }
+
+    CHECK(checked > 10);
+}
+
+// несовместная и неограниченная задачи различаются по состоянию
+void TestStatuses() {
+    Simplex infeasible({ { 1 }, { 1 } }, { 5, 2 }, { 1 }, { ConstraintType::GreaterEqual, ConstraintType::LessEqual }, SimplexMode::Max);
+    SimplexSolve solve = infeasible.SolveVerified(false);
+    CHECK(infeasible.GetStatus() == SolveStatus::Infeasible);
+    CHECK(solve.f == 0 && solve.x.empty() && !solve.certified);
+
+    Simplex unbounded({ { 1, -1 } }, { 1 }, { 1, 1 }, { ConstraintType::LessEqual }, SimplexMode::Max);
+    solve = unbounded.SolveVerified(false);
+    CHECK(unbounded.GetStatus() == SolveStatus::Unbounded);
+    CHECK(solve.f == 0 && solve.x.empty() && !solve.certified);
+}
+
+// на задачах, где дроби переполняются, успех сообщается только с допустимым планом
+void TestOverflow() {
+    int overflow = 0;
+
+    for (int seed = 0; seed < 50; seed++) {
+        LpTask task = RandomTask(seed, 6, 6, IllConditionedShape());
+
+        Simplex simplex = task.Build();
+        SimplexSolve solve = simplex.SolveVerified(false);
+
+        if (simplex.GetStatus() != SolveStatus::Optimal) {
+            CHECK(simplex.GetStatus() == SolveStatus::Overflow);
+            CHECK(solve.f == 0 && solve.x.empty());
+            overflow++;
+            continue;
+        }
+
+        for (int i = 0; i < 6; i++) {
+            double sum = 0;
+
+            for (int j = 0; j < 6; j++)
+                sum += task.a[i][j].ToDouble() * solve.x[j].ToDouble();
+
+            CHECK(sum <= task.b[i].ToDouble() + 1e-9);
+        }
+    }
+
+    CHECK(overflow > 0);
+}
+
+int main() {
+    TestAgreement();
+    TestCertifiedBasis();
+    TestStatuses();
+    TestOverflow();
+    return CheckResult("VerifiedTest");
+}